@@ -0,0 +1,527 @@
+
+#include <ScaLP/Benders.h>
+#include <ScaLP/Exception.h>
+#include <ScaLP/Solver.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <map>
+#include <set>
+
+// a subproblem with its own copies of the master variables
+struct ScaLP::Benders::Subproblem
+{
+  std::vector<ScaLP::Constraint> constraints;
+  ScaLP::Term objective;
+
+  // the subproblem with fixed master variables
+  std::unique_ptr<ScaLP::Solver> solver;
+  std::map<ScaLP::Variable,ScaLP::Variable> copies;
+  ScaLP::status stat=ScaLP::status::NOT_SOLVED;
+  ScaLP::Result res;
+
+  // the subproblem with penalized violations (created when it is infeasible)
+  std::unique_ptr<ScaLP::Solver> feasibility;
+  std::map<ScaLP::Variable,ScaLP::Variable> feasibilityCopies;
+  ScaLP::status feasibilityStat=ScaLP::status::NOT_SOLVED;
+  ScaLP::Result feasibilityRes;
+
+  // the estimation of the objective value in the master (nullptr without cut)
+  ScaLP::Variable estimate;
+
+  void build(std::unique_ptr<ScaLP::Solver> s, ScaLP::Objective::type t, const ScaLP::VariableSet& master);
+  void penalize(std::unique_ptr<ScaLP::Solver> s, const ScaLP::VariableSet& master);
+  void solve(const std::map<ScaLP::Variable,double>& x, long timeout);
+  void solveFeasibility(const std::map<ScaLP::Variable,double>& x, long timeout);
+};
+
+// replace the master variables of c by their copies (created on first use)
+static ScaLP::Constraint substitute(const ScaLP::Constraint& c, const ScaLP::VariableSet& master, std::map<ScaLP::Variable,ScaLP::Variable>& copies)
+{
+  ScaLP::Constraint r(c);
+  r.term.sum.clear();
+  for(auto& p:c.term.sum)
+  {
+    if(master.count(p.first)==0)
+    {
+      r.term.add(p.first,p.second);
+      continue;
+    }
+    auto it = copies.find(p.first);
+    if(it==copies.end())
+    {
+      ScaLP::Variable v = ScaLP::newRealVariable(p.first->getName(),p.first->getLowerBound(),p.first->getUpperBound());
+      it = copies.emplace(p.first,v).first;
+    }
+    r.term.add(it->second,p.second);
+  }
+  return r;
+}
+
+// fix the copies to the values of the master variables
+static void fix(ScaLP::Solver& s, const std::map<ScaLP::Variable,ScaLP::Variable>& copies, const std::map<ScaLP::Variable,double>& x)
+{
+  for(auto& p:copies)
+  {
+    const double v = x.at(p.first);
+    s.setBounds(p.second,v,v);
+  }
+}
+
+// the value of a master variable, unused ones are at a bound
+static double masterValue(const ScaLP::Result& r, const ScaLP::Variable& v)
+{
+  auto it = r.values.find(v);
+  if(it!=r.values.end())
+  {
+    return v->getType()==ScaLP::VariableType::REAL ? it->second : std::round(it->second);
+  }
+  if(v->getLowerBound()>-ScaLP::INF()) return v->getLowerBound();
+  if(v->getUpperBound()<ScaLP::INF()) return v->getUpperBound();
+  return 0;
+}
+
+// the linearization of the objective value of a subproblem at x:
+// the reduced costs of the fixed copies are the derivatives by the master variables
+static ScaLP::Term linearization(const ScaLP::Result& r, const std::map<ScaLP::Variable,ScaLP::Variable>& copies, const std::map<ScaLP::Variable,double>& x)
+{
+  ScaLP::Term t(r.objectiveValue);
+  for(auto& p:copies)
+  {
+    auto it = r.reducedCosts.find(p.second);
+    if(it==r.reducedCosts.end())
+    {
+      throw ScaLP::Exception("Benders decomposition needs dual values, the backend does not support them.");
+    }
+    t.add(p.first,it->second);
+    t.add(-it->second*x.at(p.first));
+  }
+  return t;
+}
+
+// t R 0 with the constant moved to the right side
+static ScaLP::Constraint cut(ScaLP::Term t, ScaLP::relation rel)
+{
+  const double rhs = -t.constant;
+  t.constant=0;
+  return ScaLP::Constraint(std::move(t),rel,rhs);
+}
+
+static double evaluate(const ScaLP::Term& t, const std::map<ScaLP::Variable,double>& x)
+{
+  double d = t.constant;
+  for(auto& p:t.sum) d+=p.second*x.at(p.first);
+  return d;
+}
+
+// call f for all elements, in parallel if requested
+template<class C, class F>
+static void forEach(C& c, bool parallel, const F& f)
+{
+  if(not parallel or c.size()<2)
+  {
+    for(auto& e:c) f(e);
+    return;
+  }
+  std::vector<std::future<void>> fs;
+  for(auto& e:c)
+  {
+    fs.push_back(std::async(std::launch::async,[&f,&e](){ f(e); }));
+  }
+  for(auto& r:fs) r.get();
+}
+
+static void checkSubproblemVariable(const ScaLP::Variable& v)
+{
+  if(v->getType()!=ScaLP::VariableType::REAL)
+  {
+    throw ScaLP::Exception("Benders decomposition: "+v->getName()+" is not a master variable, but not real.");
+  }
+}
+
+void ScaLP::Benders::Subproblem::build(std::unique_ptr<ScaLP::Solver> s, ScaLP::Objective::type t, const ScaLP::VariableSet& master)
+{
+  solver=std::move(s);
+  solver->dualValues=true;
+  for(auto& c:constraints)
+  {
+    *solver << substitute(c,master,copies);
+  }
+  solver->setObjective(ScaLP::Objective(t,objective));
+}
+
+// every constraint gets a deviation above and below, their sum is minimized
+void ScaLP::Benders::Subproblem::penalize(std::unique_ptr<ScaLP::Solver> s, const ScaLP::VariableSet& master)
+{
+  feasibility=std::move(s);
+  feasibility->dualValues=true;
+  ScaLP::Term violation;
+  for(std::size_t i=0;i<constraints.size();++i)
+  {
+    ScaLP::Constraint c = substitute(constraints[i],master,feasibilityCopies);
+    ScaLP::Variable above = ScaLP::newRealVariable("benders_above_"+std::to_string(i),0,ScaLP::INF());
+    ScaLP::Variable below = ScaLP::newRealVariable("benders_below_"+std::to_string(i),0,ScaLP::INF());
+    c.term.add(above,-1);
+    c.term.add(below,1);
+    violation.add(above,1);
+    violation.add(below,1);
+    *feasibility << c;
+  }
+  feasibility->setObjective(ScaLP::minimize(violation));
+}
+
+void ScaLP::Benders::Subproblem::solve(const std::map<ScaLP::Variable,double>& x, long timeout)
+{
+  fix(*solver,copies,x);
+  solver->timeout=timeout;
+  stat=solver->solve();
+  res=solver->getResult();
+}
+
+void ScaLP::Benders::Subproblem::solveFeasibility(const std::map<ScaLP::Variable,double>& x, long timeout)
+{
+  fix(*feasibility,feasibilityCopies,x);
+  feasibility->timeout=timeout;
+  feasibilityStat=feasibility->solve();
+  feasibilityRes=feasibility->getResult();
+}
+
+ScaLP::Benders::Benders(std::list<std::string> ls)
+  : Benders(std::list<ScaLP::Feature>(),ls)
+{
+}
+
+ScaLP::Benders::Benders(std::list<ScaLP::Feature> fs, std::list<std::string> ls)
+  : create([fs,ls](){ return new ScaLP::Solver(fs,ls); })
+{
+  // load a backend here, so a missing backend throws in the caller
+  newSolver();
+}
+
+ScaLP::Benders::Benders(std::initializer_list<std::string> ls)
+  : Benders(std::list<std::string>(ls))
+{
+}
+
+ScaLP::Benders::Benders(std::function<ScaLP::SolverBackend*()> factory)
+  : create([factory](){ return new ScaLP::Solver(factory()); })
+{
+}
+
+ScaLP::Benders::~Benders()
+{
+}
+
+std::unique_ptr<ScaLP::Solver> ScaLP::Benders::newSolver()
+{
+  std::unique_ptr<ScaLP::Solver> s(create());
+  s->quiet=quiet;
+  s->threads=threads;
+  return s;
+}
+
+void ScaLP::Benders::setObjective(const ScaLP::Objective& o)
+{
+  objective=o;
+}
+
+void ScaLP::Benders::addConstraint(const ScaLP::Constraint& c)
+{
+  cons.push_back(c);
+}
+
+void ScaLP::Benders::addMasterVariable(const ScaLP::Variable& v)
+{
+  master.insert(v);
+}
+
+void ScaLP::Benders::setProgressCallback(ScaLP::BendersCallback f)
+{
+  callback=std::move(f);
+}
+
+ScaLP::Result ScaLP::Benders::getResult() const
+{
+  return result;
+}
+
+const std::vector<ScaLP::BendersIteration>& ScaLP::Benders::getIterations() const
+{
+  return iterations;
+}
+
+ScaLP::status ScaLP::Benders::solve()
+{
+  const auto start = std::chrono::steady_clock::now();
+  auto elapsed = [&start]()
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+  };
+  // the timeout of a model (at least a second, zero is no limit)
+  auto remaining = [this,&elapsed]() -> long
+  {
+    if(timeout==0) return 0;
+    return std::max(1L,timeout-static_cast<long>(elapsed()));
+  };
+
+  iterations.clear();
+  result=ScaLP::Result();
+
+  // constraints with continuous variables belong to the subproblems
+  std::vector<ScaLP::Constraint> masterCons;
+  std::vector<ScaLP::Constraint> subCons;
+  for(auto& c:cons)
+  {
+    bool onlyMaster=true;
+    for(auto& v:c.extractVariables())
+    {
+      if(master.count(v)>0) continue;
+      checkSubproblemVariable(v);
+      onlyMaster=false;
+    }
+    if(onlyMaster)
+    {
+      masterCons.push_back(c);
+    }
+    else if(c.indicator!=nullptr)
+    {
+      throw ScaLP::Exception("Benders decomposition: indicator constraints are only allowed in the master.");
+    }
+    else
+    {
+      subCons.push_back(c);
+    }
+  }
+
+  std::vector<Subproblem> subs;
+  std::map<ScaLP::Variable,std::size_t> owner;
+  if(not subCons.empty())
+  {
+    for(auto& component:ScaLP::connectedComponents(subCons,master))
+    {
+      Subproblem p;
+      for(std::size_t i:component)
+      {
+        for(auto& q:subCons[i].term.sum)
+        {
+          if(master.count(q.first)==0) owner[q.first]=subs.size();
+        }
+        p.constraints.push_back(subCons[i]);
+      }
+      subs.push_back(std::move(p));
+    }
+  }
+
+  const ScaLP::Objective::type sense = objective.getType();
+  const bool minimizing = sense==ScaLP::Objective::type::MINIMIZE;
+  ScaLP::Term masterObjective(objective.getTerm().constant);
+  for(auto& p:objective.getTerm().sum)
+  {
+    if(master.count(p.first)>0)
+    {
+      masterObjective.add(p.first,p.second);
+      continue;
+    }
+    checkSubproblemVariable(p.first);
+    // variables without constraints go to the first subproblem
+    auto it = owner.find(p.first);
+    if(it==owner.end())
+    {
+      if(subs.empty()) subs.emplace_back();
+      subs.front().objective.add(p.first,p.second);
+    }
+    else
+    {
+      subs[it->second].objective.add(p.first,p.second);
+    }
+  }
+
+  std::unique_ptr<ScaLP::Solver> masterSolver = newSolver();
+  for(auto& c:masterCons)
+  {
+    *masterSolver << ScaLP::Constraint(c);
+  }
+  ScaLP::Term masterTerm = masterObjective;
+  masterSolver->setObjective(ScaLP::Objective(sense,masterTerm));
+  for(auto& p:subs)
+  {
+    p.build(newSolver(),sense,master);
+  }
+
+  ScaLP::status stat = ScaLP::status::UNKNOWN;
+  bool found=false;
+  double best=0;
+  std::map<ScaLP::Variable,double> x;
+  for(std::size_t iteration=1;;++iteration)
+  {
+    if(iteration>maxIterations or (timeout>0 and elapsed()>=timeout))
+    {
+      stat = found ? ScaLP::status::TIMEOUT_FEASIBLE : ScaLP::status::TIMEOUT_INFEASIBLE;
+      break;
+    }
+
+    masterSolver->timeout=remaining();
+    ScaLP::status masterStat = masterSolver->solve();
+    if(masterStat!=ScaLP::status::OPTIMAL)
+    {
+      if(masterStat==ScaLP::status::TIMEOUT_FEASIBLE or masterStat==ScaLP::status::TIMEOUT_INFEASIBLE)
+      {
+        masterStat = found ? ScaLP::status::TIMEOUT_FEASIBLE : ScaLP::status::TIMEOUT_INFEASIBLE;
+      }
+      stat=masterStat;
+      break;
+    }
+    const ScaLP::Result masterRes = masterSolver->getResult();
+    x.clear();
+    for(auto& v:master) x[v]=masterValue(masterRes,v);
+
+    ScaLP::BendersIteration info;
+    info.iteration=iteration;
+    if(std::all_of(subs.begin(),subs.end(),[](const Subproblem& p){ return p.estimate!=nullptr; }))
+    {
+      info.bound=masterRes.objectiveValue;
+    }
+
+    forEach(subs,parallel,[&x,&remaining](Subproblem& p){ p.solve(x,remaining()); });
+
+    std::vector<Subproblem*> infeasible;
+    for(auto& p:subs)
+    {
+      if(p.stat!=ScaLP::status::INFEASIBLE and p.stat!=ScaLP::status::INFEASIBLE_OR_UNBOUND) continue;
+      if(p.feasibility==nullptr) p.penalize(newSolver(),master);
+      infeasible.push_back(&p);
+    }
+    forEach(infeasible,parallel,[&x,&remaining](Subproblem* p){ p->solveFeasibility(x,remaining()); });
+
+    // the cuts
+    bool feasible=true;
+    double value=evaluate(masterObjective,x);
+    ScaLP::status failed = ScaLP::status::NOT_SOLVED;
+    for(std::size_t k=0;k<subs.size() and failed==ScaLP::status::NOT_SOLVED;++k)
+    {
+      Subproblem& p = subs[k];
+      switch(p.stat)
+      {
+        case ScaLP::status::OPTIMAL:
+        {
+          const double v = p.res.objectiveValue;
+          value+=v;
+          const double slack = tolerance*std::max(1.0,std::abs(v));
+          if(p.estimate!=nullptr)
+          {
+            const double e = masterRes.values.at(p.estimate);
+            if(minimizing ? e>=v-slack : e<=v+slack) break;
+          }
+          else
+          {
+            p.estimate=ScaLP::newRealVariable("benders_estimate_"+std::to_string(k));
+            masterTerm.add(p.estimate,1);
+            masterSolver->setObjective(ScaLP::Objective(sense,masterTerm));
+          }
+          ScaLP::Term t = linearization(p.res,p.copies,x);
+          t.add(p.estimate,-1);
+          *masterSolver << cut(std::move(t),minimizing ? ScaLP::relation::LESS_EQ_THAN : ScaLP::relation::MORE_EQ_THAN);
+          ++info.optimalityCuts;
+          break;
+        }
+        case ScaLP::status::INFEASIBLE:
+        case ScaLP::status::INFEASIBLE_OR_UNBOUND:
+        {
+          feasible=false;
+          if(p.feasibilityStat!=ScaLP::status::OPTIMAL)
+          {
+            failed=p.feasibilityStat;
+            break;
+          }
+          if(p.feasibilityRes.objectiveValue<=tolerance)
+          {
+            // no violation, so the subproblem is unbounded
+            if(p.stat==ScaLP::status::INFEASIBLE_OR_UNBOUND)
+            {
+              failed=ScaLP::status::UNBOUND;
+              break;
+            }
+            throw ScaLP::Exception("Benders decomposition: the infeasible subproblem "+std::to_string(k)+" has no violation.");
+          }
+          ScaLP::Term t = linearization(p.feasibilityRes,p.feasibilityCopies,x);
+          if(t.sum.empty())
+          {
+            // infeasible for all master solutions
+            failed=ScaLP::status::INFEASIBLE;
+            break;
+          }
+          *masterSolver << cut(std::move(t),ScaLP::relation::LESS_EQ_THAN);
+          ++info.feasibilityCuts;
+          break;
+        }
+        case ScaLP::status::TIMEOUT_FEASIBLE:
+        case ScaLP::status::TIMEOUT_INFEASIBLE:
+          failed = found ? ScaLP::status::TIMEOUT_FEASIBLE : ScaLP::status::TIMEOUT_INFEASIBLE;
+          break;
+        default:
+          failed=p.stat;
+          break;
+      }
+    }
+    if(failed!=ScaLP::status::NOT_SOLVED)
+    {
+      stat=failed;
+      break;
+    }
+
+    if(feasible and (not found or (minimizing ? value<best : value>best)))
+    {
+      found=true;
+      best=value;
+      result=ScaLP::Result();
+      result.objectiveValue=value;
+      for(auto& p:x) result.values.emplace(p.first,p.second);
+      for(auto& p:subs)
+      {
+        std::set<const ScaLP::VariableBase*> copies;
+        for(auto& q:p.copies) copies.insert(q.second.get());
+        for(auto& q:p.res.values)
+        {
+          if(copies.count(q.first.get())==0) result.values.emplace(q.first,q.second);
+        }
+      }
+    }
+
+    if(found)
+    {
+      info.incumbent=best;
+      info.gap=std::abs(best-info.bound)/std::max(1.0,std::abs(best));
+    }
+    info.time=elapsed();
+    iterations.push_back(info);
+
+    if(not quiet)
+    {
+      std::cout << "Benders iteration " << iteration
+        << ": bound " << info.bound << ", incumbent " << info.incumbent << ", gap " << info.gap
+        << ", cuts " << info.optimalityCuts << "+" << info.feasibilityCuts << std::endl;
+    }
+
+    const bool proceed = not callback or callback(info);
+    if((feasible and info.optimalityCuts==0) or info.gap<=tolerance)
+    {
+      stat=ScaLP::status::OPTIMAL;
+      break;
+    }
+    if(not proceed)
+    {
+      stat = found ? ScaLP::status::CANCELLED_FEASIBLE : ScaLP::status::CANCELLED_INFEASIBLE;
+      break;
+    }
+  }
+
+  return stat;
+}
+
+ScaLP::Benders& ScaLP::operator<<(ScaLP::Benders& b, const ScaLP::Constraint& c)
+{
+  b.addConstraint(c);
+  return b;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ScaLP/Constraint.h>
+#include <ScaLP/Objective.h>
+#include <ScaLP/Result.h>
+#include <ScaLP/SolverBackend.h>
+#include <ScaLP/Variable.h>
+
+namespace ScaLP
+{
+  class Solver;
+
+  // the state of a Benders decomposition after an iteration
+  struct BendersIteration
+  {
+    std::size_t iteration=0;
+
+    // objective value of the master problem, a lower bound for minimization
+    // (upper bound for maximization). NaN until every subproblem has a cut.
+    double bound=std::nan("");
+
+    // objective value of the best solution found so far (NaN if none)
+    double incumbent=std::nan("");
+
+    // relative difference of bound and incumbent (NaN if one is unknown)
+    double gap=std::nan("");
+
+    // the cuts added to the master in this iteration
+    std::size_t optimalityCuts=0;
+    std::size_t feasibilityCuts=0;
+
+    // seconds since the start of the decomposition
+    double time=0;
+  };
+
+  // called after every iteration, the decomposition stops if it returns false
+  using BendersCallback = std::function<bool(const ScaLP::BendersIteration&)>;
+
+  // Benders decomposition of a model with a (mixed) integer master problem
+  // and continuous subproblems.
+  // The master contains the master variables, the constraints using only
+  // them and one variable per subproblem estimating its objective value.
+  // The remaining constraints are split into subproblems without common
+  // continuous variables. For a master solution, the subproblems are solved
+  // (in parallel) with the master variables fixed, the dual values of
+  // the subproblems give optimality cuts, the dual values of a subproblem
+  // with penalized violations give feasibility cuts for the master.
+  // Every model keeps its backend, so cuts and fixings are passed as changes.
+  // The backend has to support dual values (see ScaLP::Solver::dualValues).
+  class Benders
+  {
+    public:
+      // the backends of the master and subproblems (see ScaLP::Solver)
+      Benders(std::list<std::string> ls);
+      Benders(std::list<ScaLP::Feature> fs, std::list<std::string> ls);
+      Benders(std::initializer_list<std::string> ls);
+
+      // backends of the factory (called once per model, the memory is
+      // managed by the decomposition)
+      Benders(std::function<ScaLP::SolverBackend*()> factory);
+
+      ~Benders();
+
+      Benders(const Benders&) = delete;
+      Benders& operator=(const Benders&) = delete;
+
+      //####################
+      // Parameters
+      //####################
+
+      bool quiet = true;
+
+      // timeout for the whole decomposition in seconds, zero is no limit.
+      long timeout = 0;
+
+      // threads used by each backend (0 is the default of the backend)
+      int threads = 0;
+
+      // stop if the relative gap is at most tolerance
+      double tolerance = 1e-6;
+
+      // stop after this number of iterations
+      std::size_t maxIterations = 100;
+
+      // solve the subproblems of an iteration in parallel
+      bool parallel = true;
+
+
+      //####################
+      // Problem-Construction
+      //####################
+
+      void setObjective(const ScaLP::Objective& o);
+
+      void addConstraint(const ScaLP::Constraint& c);
+
+      // mark a variable as part of the master problem.
+      // All other variables belong to the subproblems and have to be real.
+      void addMasterVariable(const ScaLP::Variable& v);
+
+
+      //####################
+      // Solving
+      //####################
+
+      // f is called after every iteration (an empty function removes it)
+      void setProgressCallback(ScaLP::BendersCallback f);
+
+      // alternate master and subproblems until the gap is closed.
+      // TIMEOUT_FEASIBLE/TIMEOUT_INFEASIBLE is returned if the timeout or
+      // maxIterations is reached first.
+      ScaLP::status solve();
+
+      // the best solution (all variables) found by the last solve
+      ScaLP::Result getResult() const;
+
+      // the iterations of the last solve
+      const std::vector<ScaLP::BendersIteration>& getIterations() const;
+
+    private:
+      struct Subproblem;
+
+      std::function<ScaLP::Solver*()> create;
+
+      ScaLP::Objective objective;
+      std::vector<ScaLP::Constraint> cons;
+      ScaLP::VariableSet master;
+
+      ScaLP::BendersCallback callback;
+
+      ScaLP::Result result;
+      std::vector<ScaLP::BendersIteration> iterations;
+
+      std::unique_ptr<ScaLP::Solver> newSolver();
+  };
+
+  ScaLP::Benders& operator<<(ScaLP::Benders& b, const ScaLP::Constraint& c);
+
+}
@@ -2,6 +2,10 @@
 #include <ScaLP/Constraint.h>
 #include <ScaLP/Exception.h>
 
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
 namespace ScaLP
 {
   extern double INF();
@@ -267,3 +271,63 @@ std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::Constraint &c)
   }
   return os;
 }
+
+std::vector<std::vector<std::size_t>> ScaLP::connectedComponents(const std::vector<ScaLP::Constraint>& cons, const ScaLP::VariableSet& ignored)
+{
+  // union-find over the variables
+  std::unordered_map<const ScaLP::VariableBase*,std::size_t> index;
+  std::vector<std::size_t> parent;
+  auto find = [&parent](std::size_t i)
+  {
+    while(parent[i]!=i)
+    {
+      parent[i]=parent[parent[i]];
+      i=parent[i];
+    }
+    return i;
+  };
+
+  const std::size_t none = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> representative(cons.size(),none);
+  auto join = [&](std::size_t c, const ScaLP::Term& t)
+  {
+    for(auto& p:t.sum)
+    {
+      if(ignored.count(p.first)>0) continue;
+      auto it = index.emplace(p.first.get(),parent.size());
+      if(it.second) parent.push_back(it.first->second);
+      const std::size_t v = find(it.first->second);
+      if(representative[c]==none) representative[c]=v;
+      else parent[v]=find(representative[c]);
+    }
+  };
+  for(std::size_t i=0;i<cons.size();++i)
+  {
+    join(i,cons[i].term);
+    if(cons[i].indicator!=nullptr) join(i,cons[i].indicator->term);
+  }
+
+  std::vector<std::vector<std::size_t>> components;
+  std::unordered_map<std::size_t,std::size_t> component;
+  std::vector<std::size_t> constant;
+  for(std::size_t i=0;i<cons.size();++i)
+  {
+    if(representative[i]==none)
+    {
+      constant.push_back(i);
+      continue;
+    }
+    auto it = component.emplace(find(representative[i]),components.size());
+    if(it.second) components.emplace_back();
+    components[it.first->second].push_back(i);
+  }
+
+  if(components.empty()) components.emplace_back();
+  if(not constant.empty())
+  {
+    std::vector<std::size_t>& first = components.front();
+    first.insert(first.end(),constant.begin(),constant.end());
+    std::sort(first.begin(),first.end());
+  }
+  return components;
+}
@@ -3,6 +3,7 @@
 
 #include <string.h>
 #include <memory>
+#include <vector>
 
 #include <ScaLP/Term.h>
 #include <ScaLP/Variable.h>
@@ -90,5 +91,10 @@ namespace ScaLP
   };
   std::ostream& operator<<(std::ostream& os, const ScaLP::Constraint &c);
 
+  // the connected components of the constraints (linked by common variables,
+  // except the ignored ones) as indices of the constraints in ascending order.
+  // Constraints without other variables belong to the first component.
+  std::vector<std::vector<std::size_t>> connectedComponents(const std::vector<ScaLP::Constraint>& cons, const ScaLP::VariableSet& ignored={});
+
 }
 
@@ -0,0 +1,56 @@
+
+#include <ScaLP/ModelBuilder.h>
+#include <ScaLP/Solver.h>
+
+#include <utility>
+
+void ScaLP::ModelBuilder::addConstraint(const Constraint& c)
+{
+  constraints.emplace_back(c);
+}
+void ScaLP::ModelBuilder::addConstraint(Constraint&& c)
+{
+  constraints.emplace_back(std::move(c));
+}
+
+void ScaLP::ModelBuilder::addObjectiveTerm(const Term& t)
+{
+  objectiveTerm+=t;
+}
+
+void ScaLP::ModelBuilder::setConstraintCount(std::size_t n)
+{
+  constraints.reserve(n);
+}
+
+std::size_t ScaLP::ModelBuilder::getConstraintCount() const
+{
+  return constraints.size();
+}
+
+const std::vector<ScaLP::Constraint>& ScaLP::ModelBuilder::getConstraints() const
+{
+  return constraints;
+}
+
+const ScaLP::Term& ScaLP::ModelBuilder::getObjectiveTerm() const
+{
+  return objectiveTerm;
+}
+
+void ScaLP::ModelBuilder::clear()
+{
+  constraints.clear();
+  objectiveTerm=ScaLP::Term();
+}
+
+ScaLP::ModelBuilder& ScaLP::operator<<(ScaLP::ModelBuilder& b, const ScaLP::Constraint& c)
+{
+  b.addConstraint(c);
+  return b;
+}
+ScaLP::ModelBuilder& ScaLP::operator<<(ScaLP::ModelBuilder& b, ScaLP::Constraint&& c)
+{
+  b.addConstraint(std::move(c));
+  return b;
+}
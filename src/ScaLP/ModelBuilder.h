@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include <ScaLP/Constraint.h>
+#include <ScaLP/Term.h>
+
+namespace ScaLP
+{
+
+  // A shard of a model, e.g. the constraints of one time period.
+  // Shards can be filled independently (one per thread) and are added to a
+  // ScaLP::Solver by ScaLP::Solver::merge.
+  // A single ModelBuilder is not thread-safe.
+  class ModelBuilder
+  {
+    public:
+      ModelBuilder() = default;
+
+      // add a constraint
+      void addConstraint(const Constraint& c);
+      void addConstraint(Constraint&& c);
+
+      // add a term to the objective of the solver
+      void addObjectiveTerm(const Term& t);
+
+      // set the number of constraints potentially used.
+      // (can give a small performance-boost)
+      void setConstraintCount(std::size_t n);
+
+      // returns the no of constraints defined so far
+      std::size_t getConstraintCount() const;
+
+      const std::vector<Constraint>& getConstraints() const;
+      const Term& getObjectiveTerm() const;
+
+      // remove all constraints and objective terms
+      void clear();
+
+    private:
+      friend class Solver;
+
+      std::vector<Constraint> constraints;
+      Term objectiveTerm;
+  };
+
+  ScaLP::ModelBuilder& operator<<(ScaLP::ModelBuilder& b, const ScaLP::Constraint& c);
+  ScaLP::ModelBuilder& operator<<(ScaLP::ModelBuilder& b, ScaLP::Constraint&& c);
+
+}
@@ -0,0 +1,33 @@
+
+#include <ScaLP/ModelStatistics.h>
+
+double ScaLP::ModelStatistics::coefficientRange() const
+{
+  if(minCoefficient==0) return 1;
+  return maxCoefficient/minCoefficient;
+}
+
+std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::ModelStatistics& s)
+{
+  os << "Variables:    " << s.variables
+     << " (binary: "  << s.binaryVariables
+     << ", integer: " << s.integerVariables
+     << ", real: "    << s.realVariables << ")\n";
+  os << "Constraints:  " << s.constraints
+     << " (equalities: " << s.equalities
+     << ", ranges: "     << s.ranges
+     << ", indicators: " << s.indicators << ")\n";
+  os << "Non-zeros:    " << s.nonzeros << "\n";
+  os << "Coefficients: [" << s.minCoefficient << ";" << s.maxCoefficient << "]"
+     << " (range: " << s.coefficientRange() << ")\n";
+  os << "RHS:          [" << s.minRHS << ";" << s.maxRHS << "]\n";
+  os << "Bounds:       [" << s.minBound << ";" << s.maxBound << "]\n";
+  os << "Row lengths:\n";
+  for(std::size_t i=0;i<s.rowLengths.size();++i)
+  {
+    if(s.rowLengths[i]==0) continue;
+    os << "  " << (i==0?0:(std::size_t(1)<<i)) << "-" << ((std::size_t(1)<<(i+1))-1)
+       << ": " << s.rowLengths[i] << "\n";
+  }
+  return os;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace ScaLP
+{
+
+  // Figures about the size and the numerics of a model.
+  // They are maintained by the Solver while the model is built, see
+  // ScaLP::Solver::statistics()
+  struct ModelStatistics
+  {
+    // variables used in the constraints or the objective
+    std::size_t variables=0;
+    std::size_t binaryVariables=0;
+    std::size_t integerVariables=0;
+    std::size_t realVariables=0;
+
+    // constraints by type
+    std::size_t constraints=0;
+    std::size_t equalities=0;
+    std::size_t ranges=0;      // d R x R d
+    std::size_t indicators=0;
+
+    // non-zero coefficients in the constraints
+    std::size_t nonzeros=0;
+
+    // smallest and largest absolute non-zero coefficient of the constraints
+    // (zero if there are none)
+    double minCoefficient=0;
+    double maxCoefficient=0;
+
+    // smallest and largest absolute non-zero finite right-hand side
+    double minRHS=0;
+    double maxRHS=0;
+
+    // smallest and largest absolute non-zero finite variable-bound
+    double minBound=0;
+    double maxBound=0;
+
+    // row-length histogram:
+    // rowLengths[i] is the number of constraints with 2^i to 2^(i+1)-1
+    // non-zeros, empty constraints are counted in rowLengths[0].
+    std::vector<std::size_t> rowLengths;
+
+    // maxCoefficient/minCoefficient (1 if there are no coefficients)
+    double coefficientRange() const;
+  };
+
+  std::ostream& operator<<(std::ostream& os, const ScaLP::ModelStatistics& s);
+
+}
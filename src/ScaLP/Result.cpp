@@ -3,6 +3,8 @@
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <cmath>
+#include <algorithm>
 #include <ScaLP/Result.h>
 
 std::string ScaLP::showStatus(ScaLP::status s)
@@ -22,6 +24,8 @@ std::string ScaLP::showStatus(ScaLP::status s)
     case ScaLP::status::ALREADY_SOLVED: return "ALREADY_SOLVED";
     case ScaLP::status::UNKNOWN:    return "UNKNOWN";
     case ScaLP::status::NO_SOLVER_FOUND:    return "NO_SOLVER_FOUND";
+    case ScaLP::status::CANCELLED_FEASIBLE: return "CANCELLED_FEASIBLE";
+    case ScaLP::status::CANCELLED_INFEASIBLE: return "CANCELLED_INFEASIBLE";
   }
   return "UNKNOWN";
 }
@@ -34,10 +38,45 @@ std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::Result &r)
   {
     os << "  " << std::left << std::setw(8) << p.first << std::setw(7) << " = " << p.second << std::endl;
   } 
-  os << "Durations:" << std::endl;
-  os << "  preparation:  " << r.preparationTime << std::endl;
-  os << "  construction: " << r.constructionTime << std::endl;
-  os << "  solving:      " << r.solvingTime << std::endl;
+  os << "Durations:                wall        cpu" << std::endl;
+  auto phase = [&os](const std::string& name, const ScaLP::Duration& d, bool always)
+  {
+    if(not always and d.wall==0 and d.cpu==0) return;
+    os << "  " << std::left << std::setw(16) << name << std::right
+       << std::setw(10) << d.wall << " " << std::setw(10) << d.cpu << std::endl;
+  };
+  const ScaLP::Timings& t = r.timings;
+  phase("extraction:",t.extraction,false);
+  phase("hashing:",t.hashing,false);
+  phase("cache read:",t.cacheRead,false);
+  phase("preparation:",t.preparation,true);
+  phase("construction:",t.construction,true);
+  phase("scheduling:",t.scheduling,false);
+  phase("solving:",t.solving,true);
+  phase("postprocessing:",t.postprocessing,false);
+  phase("cache write:",t.cacheWrite,false);
+  phase("serialization:",t.serialization,false);
+  phase("total:",t.total,false);
+  if(r.savedConstructionTime>0)
+  {
+    os << "  saved:          " << std::setw(10) << r.savedConstructionTime << std::endl;
+  }
+  os << std::left;
+  os << r.statistics;
+  return os;
+}
+
+std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::SolveStatistics &s)
+{
+  os << "Statistics:" << std::endl;
+  if(not std::isnan(s.dualBound))  os << "  dual bound:     " << s.dualBound << std::endl;
+  if(not std::isnan(s.gap))        os << "  gap:            " << s.gap << std::endl;
+  if(s.nodes>=0)                   os << "  nodes:          " << s.nodes << std::endl;
+  if(s.iterations>=0)              os << "  iterations:     " << s.iterations << std::endl;
+  if(s.solutions>=0)               os << "  solutions:      " << s.solutions << std::endl;
+  if(s.firstIncumbentTime>=0)      os << "  first solution: " << s.firstIncumbentTime << std::endl;
+  if(not std::isnan(s.relaxationBound)) os << "  LP bound:       " << s.relaxationBound << std::endl;
+  if(not std::isnan(s.relaxationGap))   os << "  LP gap:         " << s.relaxationGap << std::endl;
   return os;
 }
 std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::status &s)
@@ -70,3 +109,75 @@ bool ScaLP::Result::empty() const
 {
   return this->values.empty();
 }
+
+std::size_t ScaLP::SolutionPool::size() const
+{
+  return objectiveValues.size();
+}
+
+bool ScaLP::SolutionPool::empty() const
+{
+  return objectiveValues.empty();
+}
+
+std::size_t ScaLP::SolutionPool::index(const ScaLP::Variable& v) const
+{
+  auto it = std::lower_bound(variables.begin(),variables.end(),v);
+  if(it==variables.end() or *it!=v) return variables.size();
+  return it-variables.begin();
+}
+
+double ScaLP::SolutionPool::value(std::size_t k, std::size_t j) const
+{
+  return values[k*variables.size()+j];
+}
+
+double ScaLP::SolutionPool::value(std::size_t k, const ScaLP::Variable& v) const
+{
+  const std::size_t j = index(v);
+  return j<variables.size() ? value(k,j) : 0;
+}
+
+ScaLP::Result ScaLP::SolutionPool::result(std::size_t k) const
+{
+  ScaLP::Result r;
+  r.objectiveValue = objectiveValues[k];
+  for(std::size_t j=0;j<variables.size();++j)
+  {
+    r.values.emplace_hint(r.values.end(),variables[j],value(k,j));
+  }
+  return r;
+}
+
+void ScaLP::SolutionPool::add(const ScaLP::Result& r)
+{
+  if(empty())
+  {
+    variables.clear();
+    for(auto& p:r.values) variables.push_back(p.first);
+  }
+
+  // both are sorted, merge them
+  auto it = r.values.begin();
+  for(const ScaLP::Variable& v:variables)
+  {
+    while(it!=r.values.end() and it->first<v) ++it;
+    values.push_back((it!=r.values.end() and it->first==v) ? it->second : 0);
+  }
+  objectiveValues.push_back(r.objectiveValue);
+}
+
+std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::SolutionPool &p)
+{
+  os << "Solutions: " << p.size() << " (" << p.status << ")" << std::endl;
+  for(std::size_t k=0;k<p.size();++k)
+  {
+    os << "  " << std::left << std::setw(4) << k << "objective " << p.objectiveValues[k] << ":";
+    for(std::size_t j=0;j<p.variables.size();++j)
+    {
+      if(p.value(k,j)!=0) os << " " << p.variables[j] << "=" << p.value(k,j);
+    }
+    os << std::endl;
+  }
+  return os;
+}
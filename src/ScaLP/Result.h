@@ -1,7 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <ScaLP/Variable.h>
 
@@ -21,10 +24,81 @@ namespace ScaLP
   , NO_SOLVER_FOUND
   , ALREADY_SOLVED
   , UNKNOWN
+  , CANCELLED_FEASIBLE    // interrupted, the result is the best found so far
+  , CANCELLED_INFEASIBLE  // interrupted before a solution was found
   };
 
   std::string showStatus(ScaLP::status s);
 
+  // the duration of a phase in seconds
+  struct Duration
+  {
+    double wall=0; // monotonic wall-clock time
+    double cpu=0;  // CPU time of the process (all threads)
+  };
+
+  // the durations of the phases of ScaLP::Solver::solve
+  struct Timings
+  {
+    Duration extraction;     // collect the used variables
+    Duration hashing;        // hash of the model for the result-cache
+    Duration cacheRead;
+    Duration cacheWrite;     // including the serialization
+    Duration serialization;  // LP-file of the model for the result-cache
+    Duration preparation;    // pass the parameters to the backend
+    Duration construction;   // pass the model to the backend
+    Duration scheduling;     // wait for threads of the ScaLP::ThreadScheduler
+    Duration solving;
+    Duration postprocessing;
+    Duration total;
+  };
+
+  // statistics reported by the backend
+  // (NaN or -1 if the backend does not report the value)
+  struct SolveStatistics
+  {
+    double dualBound=std::numeric_limits<double>::quiet_NaN();
+    double gap=std::numeric_limits<double>::quiet_NaN(); // relative MIP-gap
+    long long nodes=-1;               // branch-and-bound nodes
+    long long iterations=-1;          // simplex iterations
+    long long solutions=-1;           // solutions found
+    double firstIncumbentTime=-1;     // seconds until the first solution
+
+    // filled by ScaLP::Solver (see ScaLP::Solver::solveRelaxation):
+    // the bound of the LP relaxation and the relative gap of the objective
+    // value to it
+    double relaxationBound=std::numeric_limits<double>::quiet_NaN();
+    double relaxationGap=std::numeric_limits<double>::quiet_NaN();
+  };
+
+  // a stage of a lexicographic solve (see ScaLP::Solver::setObjectives)
+  struct ObjectiveStage
+  {
+    ScaLP::status status=ScaLP::status::NOT_SOLVED;
+    double objectiveValue=0; // of the objective of the stage
+    ScaLP::Timings timings;
+  };
+
+  class Result;
+
+  // the state of a running solve, see ScaLP::Solver::setProgressCallback
+  // (NaN or -1 if the backend does not report the value)
+  struct Progress
+  {
+    double time=0;     // seconds since the start of the solve
+    double primalBound=std::numeric_limits<double>::quiet_NaN(); // objective of the incumbent
+    double dualBound=std::numeric_limits<double>::quiet_NaN();
+    double gap=std::numeric_limits<double>::quiet_NaN();         // relative MIP-gap
+    long long nodes=-1;
+
+    // the report is caused by a new incumbent (available only during the call)
+    const ScaLP::Result* incumbent=nullptr;
+  };
+
+  // return false to stop the solve
+  // (it ends with CANCELLED_FEASIBLE or CANCELLED_INFEASIBLE)
+  using ProgressCallback = std::function<bool(const ScaLP::Progress&)>;
+
   class Result
   {
     public:
@@ -33,10 +107,31 @@ namespace ScaLP
 
       std::map<ScaLP::Variable,double> values;
 
+      // wall-clock time of the phases (see timings for details)
       double preparationTime=0;
       double constructionTime=0;
       double solvingTime=0;
 
+      // estimated construction time saved by passing only the changes to the
+      // backend instead of rebuilding the model (zero after a rebuild)
+      double savedConstructionTime=0;
+
+      ScaLP::Timings timings;
+
+      ScaLP::SolveStatistics statistics;
+
+      // only for LPs solved with ScaLP::Solver::dualValues:
+      // the change of the objective value per unit of the bound of each
+      // constraint (in the order of ScaLP::Solver::getConstraints()) and the
+      // reduced costs (objective coefficient minus the duals weighted by the
+      // constraint coefficients) of the variables.
+      std::vector<double> duals;
+      std::map<ScaLP::Variable,double> reducedCosts;
+
+      // only for lexicographic objectives (see ScaLP::Solver::setObjectives):
+      // the solved stages in order, objectiveValue is the one of the last stage
+      std::vector<ScaLP::ObjectiveStage> stages;
+
       std::string showSolutionVector(bool compact=false);
       void writeSolutionVector(std::string file, bool compact=false);
 
@@ -44,7 +139,47 @@ namespace ScaLP
 
     private:
   };
+  // solutions of the same model sharing one index of the variables
+  // (see ScaLP::Solver::enumerate).
+  // The values are stored in one array, a row per solution.
+  class SolutionPool
+  {
+    public:
+
+      // OPTIMAL if the pool is complete (see ScaLP::Solver::enumerate),
+      // otherwise the status of the solve which stopped the enumeration
+      ScaLP::status status=ScaLP::status::NOT_SOLVED;
+
+      // the columns of the rows (in the order of a ScaLP::Result)
+      std::vector<ScaLP::Variable> variables;
+
+      std::vector<double> objectiveValues;
+
+      // variables.size() values per solution
+      std::vector<double> values;
+
+      std::size_t size() const;
+      bool empty() const;
+
+      // the index of v in variables (variables.size() if v is not known)
+      std::size_t index(const ScaLP::Variable& v) const;
+
+      // the value of variables[j] in the k-th solution
+      double value(std::size_t k, std::size_t j) const;
+      // the value of v in the k-th solution (0 if v is not known)
+      double value(std::size_t k, const ScaLP::Variable& v) const;
+
+      // the k-th solution as a result
+      ScaLP::Result result(std::size_t k) const;
+
+      // append the solution r.
+      // The first solution defines the variables, missing values are 0.
+      void add(const ScaLP::Result& r);
+  };
+
   std::ostream& operator<<(std::ostream& os, const ScaLP::Result &r);
+  std::ostream& operator<<(std::ostream& os, const ScaLP::SolutionPool &p);
   std::ostream& operator<<(std::ostream& os, const ScaLP::status &s);
+  std::ostream& operator<<(std::ostream& os, const ScaLP::SolveStatistics &s);
 }
 
@@ -2,6 +2,12 @@
 #include <fstream>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <vector>
 
 // directory handling
 static bool directoryExists(const std::string& s)
@@ -36,10 +42,77 @@ static double extractObjective(const std::string& s,double d)
   }
 }
 
-static std::pair<std::map<std::string,double>,double> readSolutionFile(std::string f)
+// statistics are stored as comments: "# statistic <name> <value>"
+static const std::string statisticPrefix = "statistic ";
+
+static void writeStatistics(std::ostream& s, const ScaLP::SolveStatistics& st)
+{
+  s << std::setprecision(17);
+  if(not std::isnan(st.dualBound)) s << "# " << statisticPrefix << "dualBound " << st.dualBound << "\n";
+  if(not std::isnan(st.gap))       s << "# " << statisticPrefix << "gap " << st.gap << "\n";
+  if(st.nodes>=0)                  s << "# " << statisticPrefix << "nodes " << st.nodes << "\n";
+  if(st.iterations>=0)             s << "# " << statisticPrefix << "iterations " << st.iterations << "\n";
+  if(st.solutions>=0)              s << "# " << statisticPrefix << "solutions " << st.solutions << "\n";
+  if(st.firstIncumbentTime>=0)     s << "# " << statisticPrefix << "firstIncumbentTime " << st.firstIncumbentTime << "\n";
+}
+
+static void extractStatistic(const std::string& s, ScaLP::SolveStatistics& st)
 {
-  std::map<std::string,double> m;
+  auto p = s.find(statisticPrefix);
+  if(p==std::string::npos) return;
+
+  std::istringstream ss(s.substr(p+statisticPrefix.size()));
+  std::string name;
+  double value;
+  if(not (ss >> name >> value)) return;
+
+  if(name=="dualBound")               st.dualBound=value;
+  else if(name=="gap")                st.gap=value;
+  else if(name=="nodes")              st.nodes=static_cast<long long>(value);
+  else if(name=="iterations")         st.iterations=static_cast<long long>(value);
+  else if(name=="solutions")          st.solutions=static_cast<long long>(value);
+  else if(name=="firstIncumbentTime") st.firstIncumbentTime=value;
+}
+
+// dual values of optimal solutions: "# dual <index> <value>"
+static const std::string dualPrefix = "dual ";
+
+static void writeDuals(std::ostream& s, const std::vector<double>& duals)
+{
+  s << std::setprecision(17);
+  for(std::size_t i=0;i<duals.size();++i)
+  {
+    s << "# " << dualPrefix << i << " " << duals[i] << "\n";
+  }
+}
+
+static void extractDual(const std::string& s, std::vector<double>& duals)
+{
+  auto p = s.find(dualPrefix);
+  if(p==std::string::npos) return;
+
+  std::istringstream ss(s.substr(p+dualPrefix.size()));
+  std::size_t i;
+  double value;
+  if(not (ss >> i >> value)) return;
+
+  if(duals.size()<=i) duals.resize(i+1,0);
+  duals[i]=value;
+}
+
+struct SolutionFile
+{
+  std::map<std::string,double> values;
   double objective=0;
+  ScaLP::SolveStatistics statistics;
+  std::vector<double> duals;
+};
+
+static SolutionFile readSolutionFile(std::string f)
+{
+  SolutionFile sf;
+  std::map<std::string,double>& m = sf.values;
+  double& objective = sf.objective;
 
   std::ifstream file(f.c_str());
   
@@ -55,6 +128,8 @@ static std::pair<std::map<std::string,double>,double> readSolutionFile(std::stri
     else if(line[p]=='#')
     {
       objective = extractObjective(line.substr(p+1),objective);
+      extractStatistic(line.substr(p+1),sf.statistics);
+      extractDual(line.substr(p+1),sf.duals);
       continue; // invalid or empty line with comment
     }
     else // ' '
@@ -76,19 +151,21 @@ static std::pair<std::map<std::string,double>,double> readSolutionFile(std::stri
 
     }
   }
-  return {m,objective};
+  return sf;
 }
 
-static ScaLP::Result createResult(const std::pair<std::map<std::string,double>,double>& p,const ScaLP::VariableSet& vs)
+static ScaLP::Result createResult(const SolutionFile& p,const ScaLP::VariableSet& vs)
 {
   ScaLP::Result res;
-  res.objectiveValue=p.second;
+  res.objectiveValue=p.objective;
+  res.statistics=p.statistics;
+  res.duals=p.duals;
   for(auto& v:vs)
   {
-    auto it = p.first.find(v->getName());
-    if(it!=p.first.end())
+    auto it = p.values.find(v->getName());
+    if(it!=p.values.end())
     {
-      double r = p.first.at(v->getName());
+      double r = it->second;
       res.values.emplace(v,r);
     }
     else
@@ -138,12 +215,58 @@ void ScaLP::writeOptimalSolution(const std::string& prefix, const std::string& h
   createDirectory((prefix+"/"+hash));
   std::ofstream s(prefix+"/"+hash+"/optimal.sol");
   s << res.showSolutionVector(true);
-  if(writeLP) solver.writeLP(prefix+"/"+hash+"/model.lp");
+  writeStatistics(s,res.statistics);
+  writeDuals(s,res.duals);
+  if(writeLP) writeModel(prefix,hash,solver);
 }
 void ScaLP::writeFeasibleSolution(const std::string& prefix, const std::string& hash,ScaLP::Result res, const ScaLP::Solver& solver, bool writeLP)
 {
   createDirectory((prefix+"/"+hash));
   std::ofstream s(prefix+"/"+hash+"/feasible.sol");
   s << res.showSolutionVector(true);
-  if(writeLP) solver.writeLP(prefix+"/"+hash+"/model.lp");
+  writeStatistics(s,res.statistics);
+  if(writeLP) writeModel(prefix,hash,solver);
+}
+void ScaLP::writeModel(const std::string& prefix, const std::string& hash,const ScaLP::Solver& solver)
+{
+  createDirectory((prefix+"/"+hash));
+  solver.writeLP(prefix+"/"+hash+"/model.lp");
+}
+
+bool ScaLP::hasCheckpoint(const std::string& prefix, const std::string& hash)
+{
+  return fileExists(prefix+"/"+hash+"/checkpoint.sol");
+}
+
+ScaLP::Result ScaLP::getCheckpoint(const std::string& prefix, const std::string& hash,const ScaLP::VariableSet& vs)
+{
+  return createResult(readSolutionFile(prefix+"/"+hash+"/checkpoint.sol"),vs);
+}
+
+void ScaLP::writeCheckpoint(const std::string& prefix, const std::string& hash,const ScaLP::Result& incumbent, double bound, double time)
+{
+  // a killed process leaves the old checkpoint or the new one, never a part
+  const std::string file = prefix+"/"+hash+"/checkpoint.sol";
+  {
+    std::ofstream s(file+".tmp");
+    if(not s.is_open())
+    {
+      createDirectory((prefix+"/"+hash));
+      s.open(file+".tmp");
+    }
+    ScaLP::Result res;
+    res.objectiveValue = incumbent.objectiveValue;
+    res.values = incumbent.values;
+    res.statistics.dualBound = bound;
+    s << res.showSolutionVector(true);
+    writeStatistics(s,res.statistics);
+    s << "# checkpoint time " << std::time(nullptr) << "\n";
+    s << "# checkpoint elapsed " << time << "\n";
+  }
+  std::rename((file+".tmp").c_str(),file.c_str());
+}
+
+void ScaLP::removeCheckpoint(const std::string& prefix, const std::string& hash)
+{
+  std::remove((prefix+"/"+hash+"/checkpoint.sol").c_str());
 }
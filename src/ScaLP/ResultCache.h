@@ -14,6 +14,15 @@ ScaLP::Result getOptimalSolution(const std::string& prefix, const std::string& h
 ScaLP::Result getFeasibleSolution(const std::string& prefix, const std::string& hash,const ScaLP::VariableSet& vs);
 void writeOptimalSolution(const std::string& prefix, const std::string& hash,ScaLP::Result res,const ScaLP::Solver& solver, bool writeLP);
 void writeFeasibleSolution(const std::string& prefix, const std::string& hash,ScaLP::Result res,const ScaLP::Solver& solver, bool writeLP);
+void writeModel(const std::string& prefix, const std::string& hash,const ScaLP::Solver& solver);
+
+// the latest incumbent of a running (or killed) solve, the bound is stored
+// as ScaLP::SolveStatistics::dualBound
+bool hasCheckpoint(const std::string& prefix, const std::string& hash);
+ScaLP::Result getCheckpoint(const std::string& prefix, const std::string& hash,const ScaLP::VariableSet& vs);
+// replaces the checkpoint atomically, time is the duration of the solve so far
+void writeCheckpoint(const std::string& prefix, const std::string& hash,const ScaLP::Result& incumbent, double bound, double time);
+void removeCheckpoint(const std::string& prefix, const std::string& hash);
 std::pair<bool,double> extractObjective(const std::string& s);
 
 }
@@ -0,0 +1,35 @@
+
+#include <ScaLP/SolveHandle.h>
+
+bool ScaLP::SolveHandle::cancel()
+{
+  std::lock_guard<std::mutex> lock(state->control->mutex);
+  if(state->control->finished) return false;
+  return state->control->back->interrupt();
+}
+
+void ScaLP::SolveHandle::wait() const
+{
+  state->future.wait();
+}
+
+bool ScaLP::SolveHandle::ready() const
+{
+  return state->future.wait_for(std::chrono::seconds(0))==std::future_status::ready;
+}
+
+ScaLP::status ScaLP::SolveHandle::get() const
+{
+  return state->future.get();
+}
+
+ScaLP::Result ScaLP::SolveHandle::incumbent() const
+{
+  std::lock_guard<std::mutex> lock(state->control->mutex);
+  return state->control->incumbent;
+}
+
+bool ScaLP::SolveHandle::valid() const
+{
+  return state!=nullptr;
+}
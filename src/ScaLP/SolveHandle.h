@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include <ScaLP/Result.h>
+#include <ScaLP/SolverBackend.h>
+
+namespace ScaLP
+{
+
+  // A handle to a solve running in another thread, see
+  // ScaLP::Solver::solveAsync.
+  // The Solver must not be used until the solve is finished, destroying the
+  // last copy of the handle waits for the end of the solve.
+  class SolveHandle
+  {
+    public:
+      SolveHandle() = default;
+
+      // request the interruption of the solve and return immediately.
+      // The solve ends with CANCELLED_FEASIBLE (the best result found so far)
+      // or CANCELLED_INFEASIBLE.
+      // The backend checks for it between its steps (e.g. LPs, nodes or
+      // iterations), a single long LP is not interrupted.
+      // returns false if the backend does not support interruptions or the
+      // solve is already finished.
+      bool cancel();
+
+      // wait until the solve is finished
+      void wait() const;
+
+      template<class Rep, class Period>
+      std::future_status wait_for(const std::chrono::duration<Rep,Period>& d) const
+      {
+        return state->future.wait_for(d);
+      }
+
+      // true if the solve is finished
+      bool ready() const;
+
+      // wait and return the status of the solve
+      // (the result is available by ScaLP::Solver::getResult)
+      ScaLP::status get() const;
+
+      // the best solution reported by the backend so far
+      // (empty if there is none or the backend does not report incumbents)
+      ScaLP::Result incumbent() const;
+
+      // false for a default-constructed handle
+      bool valid() const;
+
+    private:
+      friend class Solver;
+
+      // shared with the solving thread
+      struct Control
+      {
+        std::mutex mutex;
+        bool finished=false;
+        ScaLP::SolverBackend* back=nullptr;
+        ScaLP::Result incumbent;
+      };
+
+      // the future stays out of Control, the solving thread must not release
+      // the last reference to its own future.
+      struct State
+      {
+        std::shared_future<ScaLP::status> future;
+        std::shared_ptr<Control> control;
+      };
+
+      std::shared_ptr<State> state;
+  };
+
+}
@@ -1,17 +1,27 @@
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include <fstream>
 #include <ctime>
+#include <chrono>
 #include <cmath>
 #include <initializer_list>
+#include <iterator>
 #include <functional>
+#include <unordered_map>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 
 #include <ScaLP/Exception.h>
 #include <ScaLP/Solver.h>
 #include <ScaLP/Result.h>
 #include <ScaLP/SolverBackend/SolverDynamic.h>
 #include <ScaLP/ResultCache.h>
+#include <ScaLP/SolverPool.h>
 #ifdef LP_PARSER
 #include "parse.h"
 #endif
@@ -34,15 +44,15 @@ ScaLP::Solver::Solver(ScaLP::SolverBackend *b)
 }
 
 ScaLP::Solver::Solver(std::list<std::string> ls)
-  :back(newSolverDynamic(ls))
+  :back(newSolverDynamic(ls)), backendNames(ls)
 {
 }
 ScaLP::Solver::Solver(std::list<ScaLP::Feature>fs, std::list<std::string> ls)
-  :back(newSolverDynamic(fs,ls))
+  :back(newSolverDynamic(fs,ls)), backendFeatures(fs), backendNames(ls)
 {
 }
 ScaLP::Solver::Solver(std::initializer_list<std::string> ls)
-  :back(newSolverDynamic(ls))
+  :back(newSolverDynamic(ls)), backendNames(ls)
 {
 }
 
@@ -55,12 +65,14 @@ void ScaLP::Solver::setBackend(SolverBackend *b)
 {
   if(this->back!=nullptr) delete this->back;
   this->back=b;
+  this->constructed=false;
 }
 
 ScaLP::SolverBackend* ScaLP::Solver::releaseSolver()
 {
   auto* p = this->back;
   this->back=nullptr;
+  this->constructed=false;
   return p;
 }
 
@@ -95,13 +107,45 @@ static ScaLP::VariableSet extractVariables(const std::vector<ScaLP::Constraint>
 
 void ScaLP::Solver::setObjective(const Objective& o)
 {
+  this->objectives.clear();
+  this->objectiveTolerances.clear();
+  this->relaxationBound=std::nan("");
   this->modelChanged=true;
+  this->objectiveChanged=true;
+  countVariables(o.getTerm(),true);
+  countVariables(objective.getTerm(),false);
   this->objective=o;
 
   // this should throw an exception if the Objective rises a name-collision
   extractVariables(cons,objective);
 }
 
+void ScaLP::Solver::setObjectives(const std::vector<ScaLP::Objective>& os, const std::vector<double>& tolerances)
+{
+  if(os.empty())
+  {
+    throw ScaLP::Exception("ScaLP: setObjectives needs at least one objective.");
+  }
+  if(tolerances.size()>os.size())
+  {
+    throw ScaLP::Exception("ScaLP: setObjectives got more tolerances than objectives.");
+  }
+
+  // the first stage is the objective of the model (e.g. for showLP)
+  setObjective(os.front());
+  for(std::size_t i=1;i<os.size();++i)
+  {
+    // this should throw an exception if the Objective rises a name-collision
+    extractVariables(cons,os[i]);
+  }
+  if(os.size()>1)
+  {
+    objectives=os;
+    objectiveTolerances=tolerances;
+    objectiveTolerances.resize(os.size(),0);
+  }
+}
+
 static ScaLP::relation flipRelation(ScaLP::relation r)
 {
   using R = ScaLP::relation;
@@ -151,6 +195,7 @@ void ScaLP::Solver::addConstraint(Constraint& b)
 {
   constraintFeatureGuard(this->back,b);
   normalizeConstraint(b);
+  countConstraint(b,true);
   this->cons.emplace_back(b);
   modelChanged=true;
 }
@@ -158,10 +203,385 @@ void ScaLP::Solver::addConstraint(Constraint&& b)
 {
   constraintFeatureGuard(this->back,b);
   normalizeConstraint(b);
+  countConstraint(b,true);
   this->cons.emplace_back(b);
   modelChanged=true;
 }
 
+// add the variables of t to the index and throw if a name is already used by
+// a different variable.
+static void indexVariableNames(std::unordered_map<std::string,const ScaLP::VariableBase*>& names, const ScaLP::Term& t)
+{
+  for(auto& p:t.sum)
+  {
+    auto r = names.emplace(p.first->getName(),p.first.get());
+    if(not r.second and r.first->second!=p.first.get())
+    {
+      throw ScaLP::Exception("You defined multiple variables with the name: "+p.first->getName());
+    }
+  }
+}
+
+static void indexVariableNames(std::unordered_map<std::string,const ScaLP::VariableBase*>& names, const ScaLP::Constraint& c)
+{
+  indexVariableNames(names,c.term);
+  if(c.indicator!=nullptr) indexVariableNames(names,c.indicator->term);
+}
+
+void ScaLP::Solver::merge(std::vector<ScaLP::ModelBuilder>&& shards)
+{
+  // first pass: check everything before the model is changed
+  std::unordered_map<std::string,const ScaLP::VariableBase*> names;
+  std::size_t n = cons.size();
+  indexVariableNames(names,objective.getTerm());
+  for(auto& c:cons) indexVariableNames(names,c);
+  for(auto& b:shards)
+  {
+    indexVariableNames(names,b.objectiveTerm);
+    for(auto& c:b.constraints)
+    {
+      constraintFeatureGuard(this->back,c);
+      indexVariableNames(names,c);
+    }
+    n+=b.constraints.size();
+  }
+
+  // second pass: append in shard-order
+  cons.reserve(n);
+  ScaLP::Term obj = objective.getTerm();
+  bool extended=false; // the shards have objective terms
+  for(auto& b:shards)
+  {
+    for(auto& c:b.constraints)
+    {
+      normalizeConstraint(c);
+      countConstraint(c,true);
+      cons.emplace_back(std::move(c));
+    }
+    if(not b.objectiveTerm.sum.empty() or b.objectiveTerm.constant!=0)
+    {
+      obj+=b.objectiveTerm;
+      extended=true;
+    }
+    b.clear();
+  }
+
+  if(extended)
+  {
+    countVariables(obj,true);
+    countVariables(objective.getTerm(),false);
+    objective=ScaLP::Objective(objective.getType(),obj);
+    objectiveChanged=true;
+    relaxationBound=std::nan("");
+  }
+  modelChanged=true;
+}
+
+void ScaLP::Solver::merge(ScaLP::ModelBuilder&& shard)
+{
+  std::vector<ScaLP::ModelBuilder> shards;
+  shards.emplace_back(std::move(shard));
+  merge(std::move(shards));
+  shard.clear();
+}
+
+void ScaLP::Solver::setBounds(const ScaLP::Variable& v, double lb, double ub)
+{
+  if(lb==ScaLP::INF() or ub==-ScaLP::INF() or lb>ub)
+  {
+    throw ScaLP::Exception("The bounds of "+v->getName()+" are illegal: ["+std::to_string(lb)+";"+std::to_string(ub)+"]");
+  }
+
+  // remember the old bounds for pop
+  if(not scopes.empty())
+  {
+    scopes.back().bounds.emplace_back(v,v->getLowerBound(),v->getUpperBound());
+  }
+
+  v->unsafeSetLowerBound(lb);
+  v->unsafeSetUpperBound(ub);
+  relaxationBound=std::nan("");
+  changedBounds.push_back(v);
+  statisticsOutdated=true;
+  modelChanged=true;
+}
+
+void ScaLP::Solver::setConstraintBound(std::size_t i, double d)
+{
+  if(i>=cons.size())
+  {
+    throw ScaLP::Exception("ScaLP: there is no constraint "+std::to_string(i));
+  }
+  const ScaLP::Constraint& c = cons[i];
+  switch(c.ctype)
+  {
+    case ScaLP::Constraint::type::C2L: changeConstraintBounds(i,d,c.ubound); break;
+    case ScaLP::Constraint::type::C2R: changeConstraintBounds(i,c.lbound,d); break;
+    case ScaLP::Constraint::type::CEQ: changeConstraintBounds(i,d,d); break;
+    case ScaLP::Constraint::type::C3:
+      throw ScaLP::Exception("ScaLP: the constraint "+std::to_string(i)+" is a range, use setConstraintBounds");
+  }
+}
+
+void ScaLP::Solver::setConstraintBounds(std::size_t i, double lb, double ub)
+{
+  if(i>=cons.size())
+  {
+    throw ScaLP::Exception("ScaLP: there is no constraint "+std::to_string(i));
+  }
+  if(cons[i].ctype!=ScaLP::Constraint::type::C3)
+  {
+    throw ScaLP::Exception("ScaLP: the constraint "+std::to_string(i)+" is not a range, use setConstraintBound");
+  }
+  changeConstraintBounds(i,lb,ub);
+}
+
+void ScaLP::Solver::changeConstraintBounds(std::size_t i, double lb, double ub)
+{
+  ScaLP::Constraint& c = cons[i];
+  relaxationBound=std::nan("");
+
+  // remember the old bounds for pop
+  if(not scopes.empty())
+  {
+    scopes.back().constraintBounds.emplace_back(i,c.lbound,c.ubound);
+  }
+
+  countConstraint(c,false);
+  c.lbound=lb;
+  c.ubound=ub;
+  countConstraint(c,true);
+  if(i<constructedConstraints) changedConstraints.push_back(i);
+  modelChanged=true;
+}
+
+void ScaLP::Solver::push()
+{
+  scopes.push_back({cons.size(),{},{}});
+}
+
+void ScaLP::Solver::pop()
+{
+  if(scopes.empty())
+  {
+    throw ScaLP::Exception("ScaLP: pop without a matching push");
+  }
+
+  const Scope& scope = scopes.back();
+
+  // restore the bounds (the latest change first)
+  for(auto it=scope.bounds.rbegin();it!=scope.bounds.rend();++it)
+  {
+    const ScaLP::Variable& v = std::get<0>(*it);
+    v->unsafeSetLowerBound(std::get<1>(*it));
+    v->unsafeSetUpperBound(std::get<2>(*it));
+    changedBounds.push_back(v);
+    statisticsOutdated=true;
+  }
+
+  // restore the bounds of the constraints, which were added before the scope
+  for(auto it=scope.constraintBounds.rbegin();it!=scope.constraintBounds.rend();++it)
+  {
+    const std::size_t i = std::get<0>(*it);
+    if(i>=scope.constraintCount) continue;
+    countConstraint(cons[i],false);
+    cons[i].lbound=std::get<1>(*it);
+    cons[i].ubound=std::get<2>(*it);
+    countConstraint(cons[i],true);
+    if(i<constructedConstraints) changedConstraints.push_back(i);
+    modelChanged=true;
+    relaxationBound=std::nan("");
+  }
+
+  // remove the constraints added inside the scope
+  if(scope.constraintCount<constructedConstraints)
+  {
+    removedConstraints+=constructedConstraints-scope.constraintCount;
+    constructedConstraints=scope.constraintCount;
+  }
+  if(scope.constraintCount<cons.size() or not scope.bounds.empty())
+  {
+    for(auto it=cons.begin()+scope.constraintCount;it!=cons.end();++it)
+    {
+      countConstraint(*it,false);
+    }
+    cons.erase(cons.begin()+scope.constraintCount,cons.end());
+    modelChanged=true;
+    relaxationBound=std::nan("");
+  }
+
+  scopes.pop_back();
+}
+
+std::size_t ScaLP::Solver::getScopeDepth() const
+{
+  return scopes.size();
+}
+
+// extend [mn;mx] by the absolute value of d (ignoring zero and infinity)
+static void extendRange(double& mn, double& mx, double d)
+{
+  d=std::abs(d);
+  if(d==0 or d==ScaLP::INF()) return;
+  if(mn==0 or d<mn) mn=d;
+  if(d>mx) mx=d;
+}
+
+static void extendRanges(ScaLP::ModelStatistics& s, const ScaLP::Constraint& c)
+{
+  for(auto& p:c.term.sum) extendRange(s.minCoefficient,s.maxCoefficient,p.second);
+  extendRange(s.minRHS,s.maxRHS,c.ubound);
+  if(c.ctype==ScaLP::Constraint::type::C3) extendRange(s.minRHS,s.maxRHS,c.lbound);
+}
+
+static void extendRanges(ScaLP::ModelStatistics& s, const ScaLP::VariableBase& v)
+{
+  extendRange(s.minBound,s.maxBound,v.getLowerBound());
+  extendRange(s.minBound,s.maxBound,v.getUpperBound());
+}
+
+// the index of the row-length histogram for a row with n non-zeros
+static std::size_t rowLengthBucket(std::size_t n)
+{
+  std::size_t b=0;
+  while(n>1)
+  {
+    n>>=1;
+    ++b;
+  }
+  return b;
+}
+
+static std::size_t& variableTypeCount(ScaLP::ModelStatistics& s, const ScaLP::VariableBase& v)
+{
+  switch(v.getType())
+  {
+    case ScaLP::VariableType::BINARY:  return s.binaryVariables;
+    case ScaLP::VariableType::INTEGER: return s.integerVariables;
+    default:                           return s.realVariables;
+  }
+}
+
+void ScaLP::Solver::countVariables(const ScaLP::Term& t, bool add)
+{
+  for(auto& p:t.sum)
+  {
+    const ScaLP::VariableBase* v = p.first.get();
+    if(add)
+    {
+      if(variableUses[v]++>0) continue;
+      ++stats.variables;
+      ++variableTypeCount(stats,*v);
+      extendRanges(stats,*v);
+    }
+    else
+    {
+      auto it = variableUses.find(v);
+      if(it==variableUses.end() or --it->second>0) continue;
+      variableUses.erase(it);
+      --stats.variables;
+      --variableTypeCount(stats,*v);
+      statisticsOutdated=true;
+    }
+  }
+}
+
+void ScaLP::Solver::countConstraint(const ScaLP::Constraint& c, bool add)
+{
+  const std::size_t len = c.term.sum.size();
+  const std::size_t b = rowLengthBucket(len);
+  if(add)
+  {
+    ++stats.constraints;
+    if(c.ctype==ScaLP::Constraint::type::CEQ) ++stats.equalities;
+    if(c.ctype==ScaLP::Constraint::type::C3)  ++stats.ranges;
+    if(c.indicator!=nullptr)                  ++stats.indicators;
+    stats.nonzeros+=len;
+    if(stats.rowLengths.size()<=b) stats.rowLengths.resize(b+1,0);
+    ++stats.rowLengths[b];
+    extendRanges(stats,c);
+  }
+  else
+  {
+    --stats.constraints;
+    if(c.ctype==ScaLP::Constraint::type::CEQ) --stats.equalities;
+    if(c.ctype==ScaLP::Constraint::type::C3)  --stats.ranges;
+    if(c.indicator!=nullptr)                  --stats.indicators;
+    stats.nonzeros-=len;
+    --stats.rowLengths[b];
+    statisticsOutdated=true;
+  }
+
+  countVariables(c.term,add);
+  if(c.indicator!=nullptr) countVariables(c.indicator->term,add);
+}
+
+void ScaLP::Solver::addColumn(const ScaLP::Column& c)
+{
+  if(variableUses.find(c.variable.get())!=variableUses.end())
+  {
+    throw ScaLP::Exception("Scalp: The variable \"" + c.variable->getName() + "\" of the column is already used.");
+  }
+  for(auto& p:c.coefficients)
+  {
+    if(p.first>=cons.size())
+    {
+      throw ScaLP::Exception("Scalp: The column \"" + c.variable->getName() + "\" uses the non-existing constraint " + std::to_string(p.first) + ".");
+    }
+  }
+
+  for(auto& p:c.coefficients)
+  {
+    ScaLP::Constraint& con = cons[p.first];
+    --stats.rowLengths[rowLengthBucket(con.term.sum.size())];
+    con.term.add(c.variable,p.second);
+    const std::size_t b = rowLengthBucket(con.term.sum.size());
+    if(stats.rowLengths.size()<=b) stats.rowLengths.resize(b+1,0);
+    ++stats.rowLengths[b];
+    ++stats.nonzeros;
+    extendRange(stats.minCoefficient,stats.maxCoefficient,p.second);
+    countVariables(ScaLP::Term(c.variable,p.second),true);
+  }
+
+  if(c.objective!=0)
+  {
+    ScaLP::Term t = objective.getTerm();
+    t.add(c.variable,c.objective);
+    objective = ScaLP::Objective(objective.getType(),t);
+    countVariables(ScaLP::Term(c.variable,c.objective),true);
+  }
+
+  // the backend may still know the variable
+  if(constructedVariables.find(c.variable)!=constructedVariables.end()) constructed=false;
+  else if(constructed) newColumns.push_back(c);
+
+  modelChanged=true;
+  relaxationBound=std::nan("");
+}
+
+void ScaLP::Solver::resetStatistics()
+{
+  stats=ScaLP::ModelStatistics();
+  variableUses.clear();
+  statisticsOutdated=false;
+}
+
+const ScaLP::ModelStatistics& ScaLP::Solver::statistics()
+{
+  // extreme values can not be decremented, so they are recomputed
+  if(statisticsOutdated)
+  {
+    stats.minCoefficient=stats.maxCoefficient=0;
+    stats.minRHS=stats.maxRHS=0;
+    stats.minBound=stats.maxBound=0;
+    for(auto& c:cons) extendRanges(stats,c);
+    for(auto& p:variableUses) extendRanges(stats,*p.first);
+    while(not stats.rowLengths.empty() and stats.rowLengths.back()==0) stats.rowLengths.pop_back();
+    statisticsOutdated=false;
+  }
+  return stats;
+}
+
 static std::string showTermLP(const ScaLP::Term& t)
 {
 
@@ -485,8 +905,6 @@ void ScaLP::Solver::prepare()
   // set the verbosity of the backend
   back->setConsoleOutput(!quiet);
 
-  if(timeout>0) back->setTimeout(timeout);
-
   if(intFeasTol>=0) back->setIntFeasTol(intFeasTol);
 
   if(absMIPGap>=0) back->setAbsoluteMIPGap(absMIPGap);
@@ -494,9 +912,50 @@ void ScaLP::Solver::prepare()
 
   // use presolve?
   back->presolve(presolve);
+
+  // report the progress of the solve
+  if(not back->setProgressCallback(progressCallback) and progressCallback)
+  {
+    std::cerr << "ScaLP: progress callbacks are not supported by this backend, ignore it." << std::endl;
+  }
+
+  if(not back->setDualValues(dualValues) and dualValues)
+  {
+    std::cerr << "ScaLP: dual values are not supported by this backend, ignore it." << std::endl;
+  }
+}
+
+// called right before the backend solves, after the construction and the
+// wait for the scheduler
+void ScaLP::Solver::limitTime()
+{
+  // the backend gets the time until the deadline, but at most timeout
+  double limit = std::numeric_limits<double>::infinity();
+  if(timeout>0) limit = timeout;
+  if(deadline!=std::chrono::steady_clock::time_point::max())
+  {
+    const double remaining = std::chrono::duration<double>(deadline-std::chrono::steady_clock::now()).count();
+    limit = std::min(limit,std::max(0.0,remaining));
+  }
+  // remove the limit of a previous solve
+  if(not std::isinf(limit) or timeLimited) back->setTimeLimit(limit);
+  timeLimited = not std::isinf(limit);
+}
+
+void ScaLP::Solver::setProgressCallback(ScaLP::ProgressCallback f)
+{
+  progressCallback=f;
+}
+
+void ScaLP::Solver::setDeadline(double seconds)
+{
+  deadline = std::chrono::steady_clock::now()
+    + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
 }
 
-static void construction(ScaLP::SolverBackend* back, const ScaLP::VariableSet& vs, const ScaLP::Objective& obj, const std::vector<ScaLP::Constraint>& cons)
+// returns false if the deadline was reached before all constraints were added
+static bool construction(ScaLP::SolverBackend* back, const ScaLP::VariableSet& vs, const ScaLP::Objective& obj, const std::vector<ScaLP::Constraint>& cons
+  , std::chrono::steady_clock::time_point deadline)
 {
   // Add the Variables
   // Only add the used Variables.
@@ -506,11 +965,26 @@ static void construction(ScaLP::SolverBackend* back, const ScaLP::VariableSet& v
   back->setObjective(obj);
 
   // Add Constraints
-  back->addConstraints(cons);
+  if(deadline==std::chrono::steady_clock::time_point::max())
+  {
+    back->addConstraints(cons);
+    return true;
+  }
+
+  // in blocks to check the deadline in between
+  const std::size_t block = 4096;
+  for(std::size_t i=0;i<cons.size();i+=block)
+  {
+    if(std::chrono::steady_clock::now()>=deadline) return false;
+    auto first = cons.begin()+i;
+    auto last = cons.begin()+std::min(cons.size(),i+block);
+    if(i==0 and last==cons.end()) back->addConstraints(cons);
+    else back->addConstraints(std::vector<ScaLP::Constraint>(first,last));
+  }
+  return true;
 }
-static void construction(ScaLP::SolverBackend* back, const ScaLP::VariableSet& vs, const ScaLP::Objective& obj, const std::vector<ScaLP::Constraint>& cons, ScaLP::Result& start)
+static void startValues(ScaLP::SolverBackend* back, const ScaLP::VariableSet& vs, ScaLP::Result& start)
 {
-  construction(back,vs,obj,cons);
   if(start.empty())
   {
     for(auto&p:vs)
@@ -526,86 +1000,476 @@ static void construction(ScaLP::SolverBackend* back, const ScaLP::VariableSet& v
 
 void ScaLP::Solver::construct(const ScaLP::VariableSet& vs)
 {
-  if(warmStart) construction(back,vs,objective,cons,warmStartValues);
-  else construction(back,vs,objective,cons);
+  // a partial model is rebuilt by the next solve
+  constructed=false;
+  if(not construction(back,vs,objective,cons,deadline)) return;
+  if(warmStart) startValues(back,vs,warmStartValues);
+
+  // the backend is in sync with the model now
+  constructed=true;
+  constructedConstraints=cons.size();
+  removedConstraints=0;
+  objectiveChanged=false;
+  constructedVariables=vs;
+  changedBounds.clear();
+  changedConstraints.clear();
+  newColumns.clear();
 }
 void ScaLP::Solver::construct()
 {
-  auto vs = extractVariables(cons,objective);
-  if(warmStart) construction(back,vs,objective,cons,warmStartValues);
-  else construction(back,vs,objective,cons);
-}
-void ScaLP::Solver::construct(const std::string& file)
-{
-  throw ScaLP::Exception("not implemented yet.");
+  construct(extractVariables(cons,objective));
 }
 
-void ScaLP::Solver::postprocess()
+// check if the model in the backend can be updated by deltas and collect the
+// variables which are not known to the backend yet.
+bool ScaLP::Solver::updatable(const ScaLP::VariableSet& vs, ScaLP::VariableSet& added) const
 {
-  // round integer values
-  for(auto&p:this->result.values)
+  if(not constructed or not back->features.incremental) return false;
+
+  // both sets are sorted by name
+  auto it=constructedVariables.begin();
+  for(const ScaLP::Variable& v:vs)
   {
-    if(p.first->getType()==ScaLP::VariableType::INTEGER or p.first->getType()==ScaLP::VariableType::BINARY)
+    while(it!=constructedVariables.end() and (*it)->getName()<v->getName()) ++it;
+    if(it==constructedVariables.end() or (*it)->getName()!=v->getName())
     {
-      p.second = std::lround(p.second);
+      added.insert(added.end(),v);
+    }
+    else if(it->get()!=v.get())
+    { // a different variable with the same name is in the backend
+      return false;
     }
   }
+  return true;
 }
 
-template <class F>
-double time(const F& f)
-{
-  auto timer = std::clock();
-  f();
-  return (double(std::clock()-timer))/CLOCKS_PER_SEC;
-}
-
-ScaLP::status ScaLP::Solver::newSolve()
+// pass the changes since the last construction to the backend
+void ScaLP::Solver::update(const ScaLP::VariableSet& vs, const ScaLP::VariableSet& added)
 {
-  back->reset();
-
-  ScaLP::Result res= ScaLP::Result();
-  ScaLP::status stat;
+  // reconstruct on failure
+  constructed=false;
 
-  double preparationTime = time([this](){prepare();});
-  double constructionTime = time([&,this](){construct();});
-  double solvingTime = time([&stat,&res,this](){
-    std::tie(stat,res) = back->solve();
-  });
+  // the last result is a feasible start if only the objective changed
+  const bool sameRegion = removedConstraints==0 and changedBounds.empty() and changedConstraints.empty() and constructedConstraints==cons.size();
 
-  res.preparationTime = preparationTime;
-  res.constructionTime = constructionTime;
-  res.solvingTime = solvingTime;
+  if(removedConstraints>0 and not back->removeConstraints(removedConstraints))
+  {
+    throw ScaLP::Exception("Scalp: Can't remove Constraints from the backend.");
+  }
+  removedConstraints=0;
 
-  // round integer-values in the result
-  postprocess();
+  // the new columns need their coefficients in the constructed constraints,
+  // the other constraints contain them already.
+  ScaLP::VariableSet variables = added;
+  for(const ScaLP::Column& c:newColumns)
+  {
+    std::vector<std::pair<std::size_t,double>> coefficients;
+    for(auto& p:c.coefficients)
+    {
+      if(p.first<constructedConstraints) coefficients.push_back(p);
+    }
+    if(not back->addColumn(c.variable,c.objective,coefficients))
+    {
+      back->reset();
+      construct(vs);
+      return;
+    }
+    constructedVariables.insert(c.variable);
+    variables.erase(c.variable);
+  }
+  newColumns.clear();
 
-  this->result = res;
-  return stat;
-}
+  if(not variables.empty())
+  {
+    back->addVariables(variables);
+    constructedVariables.insert(variables.begin(),variables.end());
+  }
 
-ScaLP::status ScaLP::Solver::newSolve(const ScaLP::VariableSet& vs)
-{
-  back->reset();
+  if(objectiveChanged)
+  {
+    if(not back->updateObjective(objective))
+    {
+      throw ScaLP::Exception("Scalp: Can't change the objective in the backend.");
+    }
+  }
 
-  ScaLP::Result res= ScaLP::Result();
-  ScaLP::status stat;
+  for(const ScaLP::Variable& v:changedBounds)
+  {
+    if(constructedVariables.find(v)==constructedVariables.end()) continue;
+    if(added.find(v)!=added.end()) continue; // added with the current bounds
+    if(not back->setVariableBounds(v,v->getLowerBound(),v->getUpperBound()))
+    {
+      throw ScaLP::Exception("Scalp: Can't change the bounds of Variable \"" + v->getName() + "\" in the backend.");
+    }
+  }
+  changedBounds.clear();
 
-  double preparationTime = time([this](){prepare();});
-  double constructionTime = time([&,this,vs](){construct(vs);});
-  double solvingTime = time([&stat,&res,this](){
-    std::tie(stat,res) = back->solve();
-  });
+  for(std::size_t i:changedConstraints)
+  {
+    if(i>=constructedConstraints) continue; // removed or added with the current bounds
+    if(not back->setConstraintBounds(i,cons[i]))
+    {
+      back->reset();
+      construct(vs);
+      return;
+    }
+  }
+  changedConstraints.clear();
 
-  res.preparationTime = preparationTime;
-  res.constructionTime = constructionTime;
-  res.solvingTime = solvingTime;
+  if(constructedConstraints<cons.size())
+  {
+    back->addConstraints(std::vector<ScaLP::Constraint>(cons.begin()+constructedConstraints,cons.end()));
+    constructedConstraints=cons.size();
+  }
 
-  // round integer-values in the result
-  postprocess();
+  if(warmStart) startValues(back,vs,warmStartValues);
+  else if(objectiveChanged and sameRegion and back->features.warmstart and not result.values.empty())
+  {
+    back->setStartValues(result);
+  }
+  objectiveChanged=false;
 
-  this->result = res;
-  return stat;
+  constructed=true;
+}
+void ScaLP::Solver::construct(const std::string& file)
+{
+  throw ScaLP::Exception("not implemented yet.");
+}
+
+void ScaLP::Solver::postprocess()
+{
+  // round integer values (a relaxation keeps the fractional values)
+  for(auto&p:this->result.values)
+  {
+    const ScaLP::VariableType t = p.first->getType();
+    if(not relaxing and (t==ScaLP::VariableType::INTEGER or t==ScaLP::VariableType::BINARY))
+    {
+      p.second = std::lround(p.second);
+    }
+  }
+
+  // reduced costs from the duals
+  if(not result.duals.empty() and result.duals.size()==cons.size())
+  {
+    std::map<ScaLP::Variable,double>& rc = result.reducedCosts;
+    rc.clear();
+    for(auto& p:result.values) rc.emplace(p.first,objective.getTerm().getCoefficient(p.first));
+    for(std::size_t i=0;i<cons.size();++i)
+    {
+      for(auto& p:cons[i].term.sum)
+      {
+        auto it = rc.find(p.first);
+        if(it!=rc.end()) it->second-=result.duals[i]*p.second;
+      }
+    }
+  }
+}
+
+// wall-clock and CPU time since the construction
+class Stopwatch
+{
+  public:
+    Stopwatch()
+      : wall(std::chrono::steady_clock::now()), cpu(std::clock())
+    {
+    }
+
+    ScaLP::Duration elapsed() const
+    {
+      ScaLP::Duration d;
+      d.wall = std::chrono::duration<double>(std::chrono::steady_clock::now()-wall).count();
+      d.cpu = double(std::clock()-cpu)/CLOCKS_PER_SEC;
+      return d;
+    }
+
+  private:
+    std::chrono::steady_clock::time_point wall;
+    std::clock_t cpu;
+};
+
+template <class F>
+ScaLP::Duration measure(const F& f)
+{
+  Stopwatch w;
+  f();
+  return w.elapsed();
+}
+
+ScaLP::status ScaLP::Solver::newSolve()
+{
+  Stopwatch total;
+  ScaLP::VariableSet vs;
+  ScaLP::Duration extraction = measure([&vs,this](){vs=extractVariables(cons,objective);});
+
+  ScaLP::status stat = newSolve(vs);
+  result.timings.extraction = extraction;
+  result.timings.total = total.elapsed();
+  return stat;
+}
+
+// the order of the status for merging (higher is worse)
+static int severity(ScaLP::status s)
+{
+  switch(s)
+  {
+    case ScaLP::status::OPTIMAL:               return 0;
+    case ScaLP::status::FEASIBLE:              return 1;
+    case ScaLP::status::CANCELLED_FEASIBLE:    return 2;
+    case ScaLP::status::TIMEOUT_FEASIBLE:      return 3;
+    case ScaLP::status::CANCELLED_INFEASIBLE:  return 5;
+    case ScaLP::status::TIMEOUT_INFEASIBLE:    return 6;
+    case ScaLP::status::UNBOUND:               return 7;
+    case ScaLP::status::INFEASIBLE_OR_UNBOUND: return 8;
+    case ScaLP::status::INFEASIBLE:            return 9;
+    case ScaLP::status::INVALID:
+    case ScaLP::status::ERROR:
+    case ScaLP::status::NO_SOLVER_FOUND:       return 10;
+    default:                                   return 4;
+  }
+}
+
+ScaLP::status ScaLP::Solver::solveComponents(const std::vector<std::vector<std::size_t>>& components)
+{
+  std::unique_ptr<ScaLP::SolverPool> temporary;
+  ScaLP::SolverPool* workers = pool;
+  if(workers==nullptr)
+  {
+    const unsigned int n = std::min<std::size_t>(components.size(),std::max(1u,std::thread::hardware_concurrency()));
+    temporary.reset(new ScaLP::SolverPool(backendFeatures,backendNames,n));
+    temporary->quiet=quiet;
+    temporary->timeout=timeout;
+    temporary->deadline=deadline;
+    temporary->presolve=presolve;
+    temporary->threads=threads;
+    temporary->scheduler=scheduler;
+    temporary->dualValues=dualValues;
+    workers=temporary.get();
+  }
+
+  // the component of each variable
+  std::unordered_map<const ScaLP::VariableBase*,std::size_t> component;
+  for(std::size_t c=0;c<components.size();++c)
+  {
+    for(std::size_t i:components[c])
+    {
+      for(auto& p:cons[i].term.sum) component.emplace(p.first.get(),c);
+    }
+  }
+
+  // split the objective, variables only used in it belong to the first component
+  std::vector<ScaLP::Term> objectives(components.size());
+  objectives.front().add(objective.getTerm().constant);
+  for(auto& p:objective.getTerm().sum)
+  {
+    auto it = component.find(p.first.get());
+    objectives[it==component.end()?0:it->second].add(p.first,p.second);
+  }
+
+  Stopwatch solving;
+  std::vector<std::future<ScaLP::SolverPool::Outcome>> outcomes;
+  for(std::size_t c=0;c<components.size();++c)
+  {
+    ScaLP::ModelBuilder m;
+    m.setConstraintCount(components[c].size());
+    for(std::size_t i:components[c]) m.addConstraint(cons[i]);
+    outcomes.push_back(workers->submit(ScaLP::Objective(objective.getType(),objectives[c]),std::move(m)));
+  }
+
+  // merge the results
+  ScaLP::status stat = ScaLP::status::OPTIMAL;
+  ScaLP::Result res;
+  ScaLP::SolveStatistics& st = res.statistics;
+  st.dualBound=0;
+  bool duals=true;
+  res.duals.assign(cons.size(),0);
+  for(std::size_t c=0;c<components.size();++c)
+  {
+    ScaLP::SolverPool::Outcome o = outcomes[c].get();
+    if(severity(o.first)>severity(stat)) stat=o.first;
+
+    const ScaLP::Result& r = o.second;
+    res.objectiveValue+=r.objectiveValue;
+    res.values.insert(r.values.begin(),r.values.end());
+
+    const ScaLP::SolveStatistics& s = r.statistics;
+    st.dualBound+=s.dualBound; // NaN if one is unknown
+    if(s.nodes>=0) st.nodes=std::max(st.nodes,0LL)+s.nodes;
+    if(s.iterations>=0) st.iterations=std::max(st.iterations,0LL)+s.iterations;
+    if(s.gap>=0 and not (st.gap>=s.gap)) st.gap=s.gap; // the largest gap
+
+    duals = duals and r.duals.size()==components[c].size();
+    for(std::size_t i=0;duals and i<components[c].size();++i)
+    {
+      res.duals[components[c][i]]=r.duals[i];
+    }
+  }
+  if(not duals) res.duals.clear();
+
+  res.timings.solving = solving.elapsed();
+  res.solvingTime = res.timings.solving.wall;
+
+  this->result = res;
+  this->result.timings.postprocessing = measure([this](){postprocess();});
+
+  // an interrupted solve has to be repeated
+  if(stat==ScaLP::status::CANCELLED_FEASIBLE or stat==ScaLP::status::CANCELLED_INFEASIBLE)
+  {
+    modelChanged=true;
+  }
+  return stat;
+}
+
+ScaLP::status ScaLP::Solver::stopAtDeadline(const ScaLP::VariableSet& vs, ScaLP::Result& res)
+{
+  // use the warm-start values if they are a feasible solution
+  const ScaLP::Result& start = warmStartValues;
+  bool complete = warmStart and not start.empty();
+  for(auto it=vs.begin();complete and it!=vs.end();++it)
+  {
+    auto p = start.values.find(*it);
+    complete = p!=start.values.end()
+      and p->second>=(*it)->getLowerBound() and p->second<=(*it)->getUpperBound();
+  }
+  if(not complete or not isFeasible(start)) return ScaLP::status::TIMEOUT_INFEASIBLE;
+
+  const ScaLP::Term& t = objective.getTerm();
+  res.objectiveValue = t.constant;
+  for(const ScaLP::Variable& v:vs) res.values.emplace(v,start.values.at(v));
+  for(auto& p:t.sum) res.objectiveValue += p.second*res.values.at(p.first);
+  return ScaLP::status::TIMEOUT_FEASIBLE;
+}
+
+ScaLP::status ScaLP::Solver::newSolve(const ScaLP::VariableSet& vs)
+{
+  // the deadline passed before the solve (e. g. in the extraction)
+  if(std::chrono::steady_clock::now()>=deadline)
+  {
+    ScaLP::Result res;
+    ScaLP::status stat = stopAtDeadline(vs,res);
+    this->result = res;
+    postprocess();
+    modelChanged=true;
+    return stat;
+  }
+
+  if(decompose)
+  {
+    if(pool==nullptr and backendNames.empty())
+    {
+      std::cerr << "ScaLP: decompose needs a pool or the names of the backends, solve the whole model." << std::endl;
+    }
+    else if(progressCallback or solvingAsync)
+    {
+      // the workers of the components can not be cancelled or report the progress
+      std::cerr << "ScaLP: decompose does not support progress callbacks and solveAsync, solve the whole model." << std::endl;
+    }
+    else
+    {
+      std::vector<std::vector<std::size_t>> components = ScaLP::connectedComponents(cons);
+      if(components.size()>1) return solveComponents(components);
+    }
+  }
+
+  // pass only the changes to the backend if possible
+  ScaLP::VariableSet added;
+  const bool incremental = updatable(vs,added);
+  if(not incremental)
+  {
+    constructed=false;
+    back->reset();
+  }
+
+  ScaLP::Result res= ScaLP::Result();
+  ScaLP::status stat;
+
+  ScaLP::Timings timings;
+  timings.preparation = measure([this](){prepare();});
+  timings.construction = measure([&,this](){
+    if(incremental) update(vs,added);
+    else construct(vs);
+  });
+  const double constructionTime = timings.construction.wall;
+
+  // wait for threads of the scheduler, until the end of the timeout or the deadline
+  ScaLP::ThreadScheduler::Allocation allocation;
+  bool expired=false;
+  if(scheduler!=nullptr and constructed)
+  {
+    timings.scheduling = measure([&allocation,this](){
+      auto end = deadline;
+      if(timeout>0) end = std::min(end,ScaLP::ThreadScheduler::Clock::now()+std::chrono::seconds(timeout));
+      allocation = scheduler->acquire(threads>0?threads:0,priority,end);
+    });
+    expired = allocation.threads()==0;
+    if(not expired) back->setThreads(allocation.threads());
+  }
+
+  // the construction or the wait for threads reached the deadline
+  const bool overrun = not constructed or expired or std::chrono::steady_clock::now()>=deadline;
+  if(overrun)
+  {
+    stat = stopAtDeadline(vs,res);
+  }
+  else
+  {
+    limitTime();
+    timings.solving = measure([&stat,&res,this](){
+      std::tie(stat,res) = back->solve();
+    });
+  }
+  allocation.release();
+
+  res.preparationTime = timings.preparation.wall;
+  res.constructionTime = timings.construction.wall;
+  res.solvingTime = timings.solving.wall;
+
+  // estimate the time of a rebuild by the size of the last rebuild
+  if(not incremental)
+  {
+    rebuildTime=constructionTime;
+    rebuildNonzeros=stats.nonzeros;
+  }
+  else if(rebuildNonzeros>0)
+  {
+    const double estimate = rebuildTime*stats.nonzeros/rebuildNonzeros;
+    res.savedConstructionTime = std::max(0.0,estimate-constructionTime);
+  }
+
+  // the backend may still know variables of removed constraints
+  if(res.values.size()>vs.size())
+  {
+    for(auto it=res.values.begin();it!=res.values.end();)
+    {
+      if(vs.find(it->first)==vs.end()) it=res.values.erase(it);
+      else ++it;
+    }
+  }
+
+  this->result = res;
+
+  // round integer-values in the result
+  timings.postprocessing = measure([this](){postprocess();});
+  this->result.timings = timings;
+
+  // compare with the bound of the relaxation
+  if(not relaxing and objectives.empty() and not std::isnan(relaxationBound))
+  {
+    ScaLP::SolveStatistics& st = this->result.statistics;
+    st.relaxationBound = relaxationBound;
+    if(not this->result.values.empty())
+    {
+      const double obj = this->result.objectiveValue;
+      st.relaxationGap = std::abs(obj-relaxationBound)/std::max(std::abs(obj),1e-10);
+    }
+  }
+
+  // an interrupted solve has to be repeated
+  if(overrun or stat==ScaLP::status::CANCELLED_FEASIBLE or stat==ScaLP::status::CANCELLED_INFEASIBLE)
+  {
+    modelChanged=true;
+  }
+
+  return stat;
 }
 
 static std::string hashFNV(const ScaLP::Objective& objective
@@ -646,7 +1510,8 @@ static std::string hashFNV(const ScaLP::Objective& objective
   return hash;
 }
 
-static void updateCache(ScaLP::Solver& solver,const ScaLP::Result& result, const ScaLP::Objective objective, const std::string& hash, const std::string& cacheDir, bool writeLP)
+// returns true if the result was written
+static bool updateCache(ScaLP::Solver& solver,const ScaLP::Result& result, const ScaLP::Objective objective, const std::string& hash, const std::string& cacheDir)
 {
   std::ifstream f((cacheDir+"/"+hash+"/feasible.sol").c_str());
   while(f.good())
@@ -660,20 +1525,21 @@ static void updateCache(ScaLP::Solver& solver,const ScaLP::Result& result, const
       {
         if(result.objectiveValue>p.second)
         {
-          ScaLP::writeFeasibleSolution(cacheDir,hash,result,solver,writeLP);
-          break;
+          ScaLP::writeFeasibleSolution(cacheDir,hash,result,solver,false);
+          return true;
         }
       }
       else
       {
         if(result.objectiveValue<p.second)
         {
-          ScaLP::writeFeasibleSolution(cacheDir,hash,result,solver,writeLP);
-          break;
+          ScaLP::writeFeasibleSolution(cacheDir,hash,result,solver,false);
+          return true;
         }
       }
     }
   }
+  return false;
 }
 
 ScaLP::status ScaLP::Solver::solve()
@@ -681,7 +1547,13 @@ ScaLP::status ScaLP::Solver::solve()
   if(not this->modelChanged) return ScaLP::status::ALREADY_SOLVED;
   else this->modelChanged=false;
 
-  const ScaLP::VariableSet s = extractVariables(cons,objective);
+  if(not objectives.empty()) return solveLexicographic();
+
+  Stopwatch total;
+  ScaLP::Timings timings;
+
+  ScaLP::VariableSet s;
+  timings.extraction = measure([&s,this](){s=extractVariables(cons,objective);});
 
   if(not resultCacheDir.empty())
   {
@@ -689,80 +1561,739 @@ ScaLP::status ScaLP::Solver::solve()
     resultCache.directory = resultCacheDir;
   }
 
+  ScaLP::status stat;
   if(not resultCache.directory.empty())
   {
-    std::string hash=hashFNV(objective,cons,s);
-    if(ScaLP::hasOptimalSolution(resultCache.directory,hash))
+    stat = solveCached(s,timings);
+  }
+  else
+  {
+    stat = newSolve(s);
+  }
+
+  // add the phases outside of newSolve
+  ScaLP::Timings& t = this->result.timings;
+  t.extraction = timings.extraction;
+  t.hashing = timings.hashing;
+  t.cacheRead = timings.cacheRead;
+  t.cacheWrite = timings.cacheWrite;
+  t.serialization = timings.serialization;
+  t.total = total.elapsed();
+
+  return stat;
+}
+
+ScaLP::status ScaLP::Solver::solveCached(const ScaLP::VariableSet& s, ScaLP::Timings& timings)
+{
+  const std::string& dir = resultCache.directory;
+
+  std::string hash;
+  timings.hashing = measure([&,this](){hash=hashFNV(objective,cons,s);});
+
+  ScaLP::status cached = ScaLP::status::NOT_SOLVED;
+  timings.cacheRead = measure([&,this](){
+    if(ScaLP::hasOptimalSolution(dir,hash))
     {
-      this->result = ScaLP::getOptimalSolution(resultCache.directory,hash,s);
-      return ScaLP::status::OPTIMAL;
+      this->result = ScaLP::getOptimalSolution(dir,hash,s);
+      cached = ScaLP::status::OPTIMAL;
     }
-    else
+    else if(resultCache.preferCachedValues and ScaLP::hasFeasibleSolution(dir,hash))
     {
-      if(resultCache.preferCachedValues and ScaLP::hasFeasibleSolution(resultCache.directory,hash))
+      this->result = ScaLP::getFeasibleSolution(dir,hash,s);
+      cached = ScaLP::status::FEASIBLE;
+    }
+  });
+  if(cached!=ScaLP::status::NOT_SOLVED)
+  {
+    postprocess(); // reduced costs of cached duals
+    return cached;
+  }
+
+  // resume from the checkpoint of a killed solve
+  const bool checkpoints = resultCache.checkpoints;
+  const bool start = warmStart;
+  ScaLP::Result startValues;
+  bool resumed=false;
+  if(checkpoints and back->features.warmstart and ScaLP::hasCheckpoint(dir,hash))
+  {
+    startValues = warmStartValues;
+    warmStartValues = ScaLP::getCheckpoint(dir,hash,s);
+    warmStart = true;
+    resumed = true;
+  }
+
+  // write the incumbents while solving
+  const ScaLP::ProgressCallback callback = progressCallback;
+  if(checkpoints)
+  {
+    const double interval = resultCache.checkpointInterval;
+    double last = -std::numeric_limits<double>::infinity();
+    // the latest incumbent inside the interval, written with the next report
+    ScaLP::Result skipped;
+    ScaLP::Progress skippedAt;
+    bool pending=false;
+    progressCallback = [dir,hash,interval,last,skipped,skippedAt,pending,callback](const ScaLP::Progress& p) mutable
+    {
+      if(p.incumbent!=nullptr and p.time-last>=interval)
       {
-        this->result = ScaLP::getFeasibleSolution(resultCache.directory,hash,s);
-        return ScaLP::status::FEASIBLE;
+        ScaLP::writeCheckpoint(dir,hash,*p.incumbent,p.dualBound,p.time);
+        last = p.time;
+        pending = false;
       }
-      auto stat = newSolve(s);
-      if(stat==ScaLP::status::OPTIMAL)
+      else if(p.incumbent!=nullptr)
       {
-        ScaLP::writeOptimalSolution(resultCache.directory,hash,this->result,*this,resultCache.addModel);
+        skipped = *p.incumbent;
+        skippedAt = p;
+        pending = true;
       }
-      else if(stat==ScaLP::status::FEASIBLE or stat==ScaLP::status::TIMEOUT_FEASIBLE)
+      else if(pending and p.time-last>=interval)
       {
-        if(not ScaLP::hasFeasibleSolution(resultCache.directory,hash))
+        ScaLP::writeCheckpoint(dir,hash,skipped,skippedAt.dualBound,skippedAt.time);
+        last = p.time;
+        pending = false;
+      }
+      return not callback or callback(p);
+    };
+  }
+
+  ScaLP::status stat;
+  try
+  {
+    stat = newSolve(s);
+  }
+  catch(...)
+  {
+    progressCallback = callback;
+    if(resumed) warmStartValues = startValues;
+    warmStart = start;
+    throw;
+  }
+  progressCallback = callback;
+  if(resumed) warmStartValues = startValues;
+  warmStart = start;
+
+  timings.cacheWrite = measure([&,this](){
+    bool written=false;
+    if(stat==ScaLP::status::OPTIMAL)
+    {
+      ScaLP::writeOptimalSolution(dir,hash,this->result,*this,false);
+      written=true;
+    }
+    else if(stat==ScaLP::status::FEASIBLE or stat==ScaLP::status::TIMEOUT_FEASIBLE or stat==ScaLP::status::CANCELLED_FEASIBLE)
+    {
+      if(not ScaLP::hasFeasibleSolution(dir,hash))
+      {
+        ScaLP::writeFeasibleSolution(dir,hash,this->result,*this,false);
+        written=true;
+      }
+      else
+      {
+        written=updateCache(*this,this->result,this->objective,hash,dir);
+      }
+    }
+
+    // writing the model is skipped after the deadline
+    if(written and resultCache.addModel and std::chrono::steady_clock::now()<deadline)
+    {
+      timings.serialization = measure([&,this](){ScaLP::writeModel(dir,hash,*this);});
+    }
+
+    // the solve ended, the checkpoint is only a feasible solution now
+    if(checkpoints and ScaLP::hasCheckpoint(dir,hash))
+    {
+      if(stat!=ScaLP::status::OPTIMAL)
+      {
+        ScaLP::Result c = ScaLP::getCheckpoint(dir,hash,s);
+        if(not ScaLP::hasFeasibleSolution(dir,hash)) ScaLP::writeFeasibleSolution(dir,hash,c,*this,false);
+        else updateCache(*this,c,this->objective,hash,dir);
+      }
+      ScaLP::removeCheckpoint(dir,hash);
+    }
+  });
+
+  if(stat==ScaLP::status::TIMEOUT_INFEASIBLE)
+  {
+    bool found=false;
+    ScaLP::Duration d = measure([&,this](){
+      if(ScaLP::hasFeasibleSolution(dir,hash))
+      {
+        // keep the durations and statistics of the solve
+        ScaLP::Result r = ScaLP::getFeasibleSolution(dir,hash,s);
+        r.preparationTime = this->result.preparationTime;
+        r.constructionTime = this->result.constructionTime;
+        r.solvingTime = this->result.solvingTime;
+        r.timings = this->result.timings;
+        r.statistics = this->result.statistics;
+        this->result = r;
+        found=true;
+      }
+    });
+    timings.cacheRead.wall += d.wall;
+    timings.cacheRead.cpu += d.cpu;
+    if(found) return ScaLP::status::TIMEOUT_FEASIBLE;
+  }
+  return stat;
+}
+
+ScaLP::status ScaLP::Solver::solve(const ScaLP::Result& start)
+{
+  this->warmStartValues=start;
+  return solve();
+}
+
+ScaLP::status ScaLP::Solver::solveWithSeparator(ScaLP::Separator f, std::size_t maxRounds)
+{
+  // only the violated constraints are of interest
+  auto violated = [&f](const ScaLP::Result& r)
+  {
+    std::vector<ScaLP::Constraint> cs;
+    for(ScaLP::Constraint& c:f(r))
+    {
+      if(not c.isFeasible(r)) cs.push_back(std::move(c));
+    }
+    return cs;
+  };
+
+  // separation inside the backend (not with decompose, the components are
+  // solved by other backends), remember the generated constraints
+  std::vector<ScaLP::Constraint> generated;
+  std::set<std::string> known;
+  const bool inside = not decompose and back->setSeparator([&](const ScaLP::Result& r)
+  {
+    std::vector<ScaLP::Constraint> cs = violated(r);
+    for(ScaLP::Constraint& c:cs)
+    {
+      if(known.insert(c.show()).second) generated.push_back(c);
+    }
+    return cs;
+  });
+
+  if(inside)
+  {
+    ScaLP::status stat;
+    try
+    {
+      stat = newSolve();
+    }
+    catch(...)
+    {
+      back->setSeparator(nullptr);
+      throw;
+    }
+    back->setSeparator(nullptr);
+
+    // the backend forgets them, the next (incremental) solve adds them as
+    // normal constraints
+    for(ScaLP::Constraint& c:generated) addConstraint(std::move(c));
+    modelChanged = stat==ScaLP::status::CANCELLED_FEASIBLE or stat==ScaLP::status::CANCELLED_INFEASIBLE;
+    return stat;
+  }
+
+  // otherwise solve again with the new rows
+  for(std::size_t round=0;round<maxRounds;++round)
+  {
+    ScaLP::status stat = newSolve();
+    if(stat!=ScaLP::status::OPTIMAL and stat!=ScaLP::status::FEASIBLE
+        and stat!=ScaLP::status::TIMEOUT_FEASIBLE and stat!=ScaLP::status::CANCELLED_FEASIBLE)
+    {
+      return stat;
+    }
+
+    std::vector<ScaLP::Constraint> cs = violated(result);
+    if(cs.empty())
+    {
+      modelChanged = stat==ScaLP::status::CANCELLED_FEASIBLE;
+      return stat;
+    }
+    for(ScaLP::Constraint& c:cs) addConstraint(std::move(c));
+
+    // no time left for another round, the result is not feasible
+    if(stat==ScaLP::status::TIMEOUT_FEASIBLE) return ScaLP::status::TIMEOUT_INFEASIBLE;
+    if(stat==ScaLP::status::CANCELLED_FEASIBLE) return ScaLP::status::CANCELLED_INFEASIBLE;
+  }
+  return ScaLP::status::UNKNOWN;
+}
+
+ScaLP::status ScaLP::Solver::solveWithColumnGeneration(ScaLP::Pricer f, std::size_t maxRounds)
+{
+  if(not back->setDualValues(true))
+  {
+    throw ScaLP::Exception("Scalp: Column generation needs dual values, they are not supported by " + getBackendName() + ".");
+  }
+
+  // smaller reduced costs are treated as zero
+  const double tolerance = 1e-6;
+  const bool maximize = objective.getType()==ScaLP::Objective::type::MAXIMIZE;
+
+  const bool duals = dualValues;
+  dualValues=true;
+  try
+  {
+    for(std::size_t round=0;round<maxRounds;++round)
+    {
+      ScaLP::status stat = newSolve();
+      if(stat!=ScaLP::status::OPTIMAL or result.duals.size()!=cons.size())
+      {
+        dualValues=duals;
+        return stat;
+      }
+
+      std::size_t improving=0;
+      for(const ScaLP::Column& c:f(result))
+      {
+        double rc = c.objective;
+        for(auto& p:c.coefficients)
         {
-          ScaLP::writeFeasibleSolution(resultCache.directory,hash,this->result,*this,resultCache.addModel);
+          if(p.first<cons.size()) rc-=result.duals[p.first]*p.second;
         }
-        else
+        if(maximize ? rc>tolerance : rc<-tolerance)
         {
-          updateCache(*this,this->result,this->objective,hash,resultCache.directory,resultCache.addModel);
+          addColumn(c);
+          ++improving;
         }
       }
-      else if(stat==ScaLP::status::TIMEOUT_INFEASIBLE)
+
+      if(improving==0)
+      { // the result is optimal for all columns
+        modelChanged=false;
+        dualValues=duals;
+        return stat;
+      }
+    }
+  }
+  catch(...)
+  {
+    dualValues=duals;
+    throw;
+  }
+  dualValues=duals;
+  return ScaLP::status::UNKNOWN;
+}
+
+ScaLP::status ScaLP::Solver::solveRelaxation()
+{
+  // the components would be solved by other backends
+  const bool components = decompose;
+  decompose=false;
+
+  // the backend treats the variables as real, rebuild if it can not change
+  // them in place
+  if(not back->setRelaxation(true)) constructed=false;
+  relaxing=true;
+  ScaLP::status stat;
+  bool inPlace=false;
+  try
+  {
+    stat = newSolve();
+    inPlace = back->setRelaxation(false);
+  }
+  catch(...)
+  {
+    relaxing=false;
+    decompose=components;
+    constructed=constructed and back->setRelaxation(false);
+    modelChanged=true;
+    throw;
+  }
+  relaxing=false;
+  decompose=components;
+  if(not inPlace) constructed=false;
+
+  // the integer problem is not solved yet
+  modelChanged=true;
+
+  if(stat==ScaLP::status::OPTIMAL)
+  {
+    relaxationBound=result.objectiveValue;
+    result.statistics.relaxationBound=relaxationBound;
+  }
+  return stat;
+}
+
+double ScaLP::Solver::getRelaxationBound() const
+{
+  return relaxationBound;
+}
+
+ScaLP::status ScaLP::Solver::solveLexicographic()
+{
+  Stopwatch total;
+  const std::vector<ScaLP::Objective> os = objectives;
+  const std::vector<double> tolerances = objectiveTolerances;
+  const bool start = warmStart;
+  const ScaLP::Result startValues = warmStartValues;
+
+  std::vector<ScaLP::ObjectiveStage> stages;
+  ScaLP::status stat = ScaLP::status::NOT_SOLVED;
+  const std::size_t depth = scopes.size();
+  push();
+  try
+  {
+    for(std::size_t i=0;i<os.size();++i)
+    {
+      if(i>0)
+      { // keep the optimum of the previous stage
+        const ScaLP::Objective& prev = os[i-1];
+        const double opt = result.objectiveValue;
+        const double slack = tolerances[i-1]*std::abs(opt);
+        ScaLP::Term t = prev.getTerm();
+        const double c = t.constant;
+        t.constant=0;
+        if(prev.getType()==ScaLP::Objective::type::MAXIMIZE) addConstraint(t >= opt-slack-c);
+        else addConstraint(t <= opt+slack-c);
+
+        // the previous solution satisfies it
+        warmStart = start or (not result.values.empty() and back->features.warmstart);
+        if(warmStart) warmStartValues = result;
+      }
+      this->objective = os[i];
+      this->objectiveChanged = true;
+
+      Stopwatch stage;
+      stat = newSolve();
+
+      ScaLP::ObjectiveStage s;
+      s.status = stat;
+      s.objectiveValue = result.objectiveValue;
+      s.timings = result.timings;
+      s.timings.total = stage.elapsed();
+      stages.push_back(s);
+
+      if(stat!=ScaLP::status::OPTIMAL) break;
+    }
+  }
+  catch(...)
+  {
+    while(scopes.size()>depth) pop();
+    this->objective = os.front();
+    this->objectiveChanged = true;
+    warmStart=start;
+    warmStartValues=startValues;
+    modelChanged=true;
+    throw;
+  }
+  pop();
+  this->objective = os.front();
+  this->objectiveChanged = true;
+  warmStart=start;
+  warmStartValues=startValues;
+
+  result.stages = std::move(stages);
+  result.timings.total = total.elapsed();
+  modelChanged = stat!=ScaLP::status::OPTIMAL;
+  return stat;
+}
+
+std::vector<std::pair<ScaLP::status,ScaLP::Result>> ScaLP::Solver::sweepSequential(const std::vector<ScaLP::SweepPoint>& ps)
+{
+  const ScaLP::Objective base = objective;
+  const bool start = warmStart;
+  const ScaLP::Result startValues = warmStartValues;
+  bool changed=false; // the objective differs from base
+
+  std::vector<std::pair<ScaLP::status,ScaLP::Result>> outcomes;
+  outcomes.reserve(ps.size());
+  const std::size_t depth = scopes.size();
+  try
+  {
+    for(const ScaLP::SweepPoint& p:ps)
+    {
+      push();
+      for(auto& b:p.bounds) setConstraintBound(b.first,b.second);
+      if(not p.objective.empty())
       {
-        if(ScaLP::hasFeasibleSolution(resultCache.directory,hash))
+        ScaLP::Term t = base.getTerm();
+        for(auto& c:p.objective)
         {
-          this->result = ScaLP::getFeasibleSolution(resultCache.directory,hash,s);
-          return ScaLP::status::TIMEOUT_FEASIBLE;
+          if(c.second==0) t.sum.erase(c.first);
+          else t.sum[c.first]=c.second;
         }
+        setObjective(ScaLP::Objective(base.getType(),t));
+        changed=true;
       }
-      return stat;
+      else if(changed)
+      {
+        setObjective(base);
+        changed=false;
+      }
+
+      // start from the solution of the previous point (or the values of the user)
+      const bool previous = not outcomes.empty() and not result.values.empty() and back->features.warmstart;
+      warmStart = start or previous;
+      modelChanged=true;
+      ScaLP::status stat = warmStart ? solve(previous ? ScaLP::Result(result) : startValues) : solve();
+      outcomes.emplace_back(stat,result);
+      pop();
     }
   }
-  else
+  catch(...)
   {
-    return newSolve(s);
+    while(scopes.size()>depth) pop();
+    if(changed) setObjective(base);
+    warmStart=start;
+    warmStartValues=startValues;
+    throw;
   }
+  if(changed) setObjective(base);
+  warmStart=start;
+  warmStartValues=startValues;
+  return outcomes;
 }
 
-ScaLP::status ScaLP::Solver::solve(const ScaLP::Result& start)
+std::vector<std::pair<ScaLP::status,ScaLP::Result>> ScaLP::Solver::sweep(const std::vector<ScaLP::SweepPoint>& ps, unsigned int workers)
 {
-  this->warmStartValues=start;
-  return solve();
+  workers = std::min<std::size_t>(workers,ps.size());
+  if(workers<=1) return sweepSequential(ps);
+  if(backendNames.empty())
+  {
+    std::cerr << "ScaLP: a parallel sweep needs the names of the backends, solve the points in order." << std::endl;
+    return sweepSequential(ps);
+  }
+
+  // a copy of the model per worker (the backends are loaded here, so a
+  // missing backend throws in the caller)
+  std::vector<std::unique_ptr<ScaLP::Solver>> solvers;
+  for(unsigned int w=0;w<workers;++w)
+  {
+    std::unique_ptr<ScaLP::Solver> s(new ScaLP::Solver(backendFeatures,backendNames));
+    s->quiet=quiet;
+    s->timeout=timeout;
+    s->deadline=deadline;
+    s->intFeasTol=intFeasTol;
+    s->presolve=presolve;
+    s->threads=threads;
+    s->scheduler=scheduler;
+    s->priority=priority;
+    s->dualValues=dualValues;
+    if(relMIPGap>=0) s->setRelativeMIPGap(relMIPGap);
+    if(absMIPGap>=0) s->setAbsoluteMIPGap(absMIPGap);
+    s->setObjective(objective);
+    s->setConstraintCount(cons.size());
+    for(const ScaLP::Constraint& c:cons) s->addConstraint(ScaLP::Constraint(c));
+    solvers.push_back(std::move(s));
+  }
+
+  // contiguous chunks, so the following points of a worker are similar
+  const std::size_t size = (ps.size()+workers-1)/workers;
+  std::vector<std::future<std::vector<std::pair<ScaLP::status,ScaLP::Result>>>> chunks;
+  for(unsigned int w=0;w<workers;++w)
+  {
+    const std::size_t begin = std::min(ps.size(),w*size);
+    const std::size_t end = std::min(ps.size(),begin+size);
+    ScaLP::Solver* s = solvers[w].get();
+    chunks.push_back(std::async(std::launch::async,[s,&ps,begin,end]()
+    {
+      return s->sweepSequential(std::vector<ScaLP::SweepPoint>(ps.begin()+begin,ps.begin()+end));
+    }));
+  }
+
+  std::vector<std::pair<ScaLP::status,ScaLP::Result>> outcomes;
+  outcomes.reserve(ps.size());
+  for(auto& c:chunks)
+  {
+    std::vector<std::pair<ScaLP::status,ScaLP::Result>> os = c.get();
+    outcomes.insert(outcomes.end(),std::make_move_iterator(os.begin()),std::make_move_iterator(os.end()));
+  }
+  return outcomes;
+}
+
+ScaLP::SolutionPool ScaLP::Solver::enumerate(std::size_t k, double gapTolerance)
+{
+  // smaller differences of objective values are ties
+  const double tolerance = 1e-6;
+  const bool maximize = objective.getType()==ScaLP::Objective::type::MAXIMIZE;
+
+  // the solutions are distinguished by the binary variables
+  std::vector<ScaLP::Variable> binaries;
+  for(const ScaLP::Variable& v:extractVariables(cons,objective))
+  {
+    if(v->getType()==ScaLP::VariableType::REAL) continue;
+    if(v->getLowerBound()<0 or v->getUpperBound()>1)
+    {
+      throw ScaLP::Exception("ScaLP: enumerate supports binary and real variables only, "+v->getName()+" is a general integer variable.");
+    }
+    binaries.push_back(v);
+  }
+  auto key = [&binaries](const ScaLP::Result& r)
+  {
+    std::vector<bool> ones;
+    ones.reserve(binaries.size());
+    for(const ScaLP::Variable& b:binaries)
+    {
+      auto it = r.values.find(b);
+      ones.push_back(it!=r.values.end() and std::lround(it->second)==1);
+    }
+    return ones;
+  };
+
+  ScaLP::SolutionPool pool;
+  std::set<std::vector<bool>> found;
+  ScaLP::Result best;
+  double limit=0; // the worst objective value of interest
+
+  // the components are solved by other backends
+  const bool stored = not decompose and back->setSolutionPool(k);
+  const std::size_t depth = scopes.size();
+  push();
+  try
+  {
+    while(k==0 or pool.size()<k)
+    {
+      ScaLP::status stat = newSolve();
+      if(stat==ScaLP::status::INFEASIBLE and not pool.empty())
+      { // every solution is in the pool
+        pool.status=ScaLP::status::OPTIMAL;
+        break;
+      }
+      if(stat!=ScaLP::status::OPTIMAL)
+      {
+        pool.status=stat;
+        break;
+      }
+
+      const double obj = result.objectiveValue;
+      if(pool.empty())
+      {
+        best=result;
+        const double slack = gapTolerance*std::abs(obj)+tolerance*std::max(1.0,std::abs(obj));
+        limit = maximize ? obj-slack : obj+slack;
+      }
+      else if(maximize ? obj<limit : obj>limit)
+      {
+        pool.status=ScaLP::status::OPTIMAL;
+        break;
+      }
+
+      // the stored solutions as good as the optimum are optimal too
+      std::vector<ScaLP::Result> candidates{result};
+      if(stored)
+      {
+        for(ScaLP::Result& r:back->getSolutions())
+        {
+          if(std::abs(r.objectiveValue-obj)<=tolerance*std::max(1.0,std::abs(obj))) candidates.push_back(std::move(r));
+        }
+      }
+
+      std::size_t added=0;
+      for(ScaLP::Result& r:candidates)
+      {
+        if(k!=0 and pool.size()==k) break;
+        std::vector<bool> ones = key(r);
+        if(not found.insert(ones).second) continue;
+
+        for(std::size_t i=0;i<binaries.size();++i) r.values[binaries[i]] = ones[i];
+        pool.add(r);
+        ++added;
+
+        // exclude it: at least one binary variable has to change
+        ScaLP::Term t;
+        double rhs=1;
+        for(std::size_t i=0;i<binaries.size();++i)
+        {
+          t.add(binaries[i],ones[i]?-1:1);
+          if(ones[i]) rhs-=1;
+        }
+        addConstraint(t>=rhs);
+      }
+
+      if(binaries.empty())
+      { // the optimum is the only solution
+        pool.status=ScaLP::status::OPTIMAL;
+        break;
+      }
+      if(added==0)
+      { // the backend returned an excluded solution
+        pool.status=ScaLP::status::UNKNOWN;
+        break;
+      }
+    }
+    if(k!=0 and pool.size()==k) pool.status=ScaLP::status::OPTIMAL;
+  }
+  catch(...)
+  {
+    while(scopes.size()>depth) pop();
+    if(stored) back->setSolutionPool(0);
+    throw;
+  }
+  pop();
+  if(stored) back->setSolutionPool(0);
+
+  if(not pool.empty())
+  {
+    result=best;
+    modelChanged=false;
+  }
+  return pool;
+}
+
+ScaLP::SolveHandle ScaLP::Solver::solveAsync()
+{
+  auto control = std::make_shared<ScaLP::SolveHandle::Control>();
+  control->back=back;
+
+  back->clearInterrupt();
+  back->setIncumbentCallback([control](const ScaLP::Result& r)
+  {
+    std::lock_guard<std::mutex> lock(control->mutex);
+    control->incumbent=r;
+  });
+
+  ScaLP::SolveHandle h;
+  h.state = std::make_shared<ScaLP::SolveHandle::State>();
+  h.state->control=control;
+  h.state->future = std::async(std::launch::async,[this,control]()
+  {
+    // later cancel-calls must not hit the next solve
+    auto finish = [this,&control]()
+    {
+      std::lock_guard<std::mutex> lock(control->mutex);
+      control->finished=true;
+      solvingAsync=false;
+      back->clearInterrupt();
+      back->setIncumbentCallback(nullptr);
+    };
+
+    try
+    {
+      solvingAsync=true;
+      ScaLP::status stat = solve();
+      finish();
+      return stat;
+    }
+    catch(...)
+    {
+      finish();
+      throw;
+    }
+  }).share();
+
+  return h;
 }
 
 ScaLP::status ScaLP::Solver::solve(const std::string& file)
 {
   // reset the backend
+  constructed=false;
   back->reset();
 
   ScaLP::status stat;
   ScaLP::Result res= ScaLP::Result();
   
-  double preparationTime = time([this](){prepare();});
-  double constructionTime = time([&,this](){construct(file);});
-  double solvingTime = time([&stat,&res,this](){
+  ScaLP::Timings timings;
+  timings.preparation = measure([this](){prepare();});
+  timings.construction = measure([&,this](){construct(file);});
+  limitTime();
+  timings.solving = measure([&stat,&res,this](){
     std::tie(stat,res) = back->solve();
   });
 
-  result.preparationTime = preparationTime;
-  result.constructionTime = constructionTime;
-  result.solvingTime = solvingTime;
+  result.preparationTime = timings.preparation.wall;
+  result.constructionTime = timings.construction.wall;
+  result.solvingTime = timings.solving.wall;
 
   // round integer-values in the result
-  postprocess();
+  timings.postprocessing = measure([this](){postprocess();});
+  result.timings = timings;
 
   return stat;
 }
@@ -777,10 +2308,25 @@ void ScaLP::Solver::reset()
   modelChanged=true;
   if(back!=nullptr) back->reset();
   objective=ScaLP::Objective();
+  objectives.clear();
+  objectiveTolerances.clear();
   cons.clear();
   result=ScaLP::Result();
   warmStartValues=ScaLP::Result();
   warmStart=false;
+  scopes.clear();
+  constructed=false;
+  constructedConstraints=0;
+  removedConstraints=0;
+  objectiveChanged=false;
+  constructedVariables.clear();
+  changedBounds.clear();
+  changedConstraints.clear();
+  newColumns.clear();
+  rebuildTime=0;
+  rebuildNonzeros=0;
+  relaxationBound=std::nan("");
+  resetStatistics();
 }
 
 // x*d
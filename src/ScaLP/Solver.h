@@ -1,24 +1,64 @@
 #pragma once
 
+#include <chrono>
+#include <limits>
 #include <list>
+#include <map>
 #include <vector>
 #include <initializer_list>
 #include <string>
+#include <tuple>
+#include <functional>
+#include <unordered_map>
+#include <utility>
 
 #include <ScaLP/Constraint.h>
+#include <ScaLP/ModelBuilder.h>
+#include <ScaLP/ModelStatistics.h>
 #include <ScaLP/Objective.h>
 #include <ScaLP/Objective.h>
 #include <ScaLP/Result.h>
+#include <ScaLP/SolveHandle.h>
 #include <ScaLP/SolverBackend.h>
 #include <ScaLP/Term.h>
+#include <ScaLP/ThreadScheduler.h>
 #include <ScaLP/Variable.h>
 
 namespace ScaLP
 {
 
+  class SolverPool;
+
   // a representation of infinity (used for variable-ranges only)
   double INF();
 
+  // a new variable for existing constraints (see ScaLP::Solver::addColumn)
+  struct Column
+  {
+    Column(ScaLP::Variable v, double obj=0, std::vector<std::pair<std::size_t,double>> cs={})
+      : variable(v), objective(obj), coefficients(std::move(cs))
+    {
+    }
+
+    ScaLP::Variable variable;
+    double objective; // coefficient in the objective
+    // (index of the constraint in ScaLP::Solver::getConstraints(), coefficient)
+    std::vector<std::pair<std::size_t,double>> coefficients;
+  };
+
+  // gets the solution of the restricted master (with dual values) and returns
+  // new columns, nothing if there are none.
+  using Pricer = std::function<std::vector<ScaLP::Column>(const ScaLP::Result&)>;
+
+  // the changes of a point of a parametric sweep (see ScaLP::Solver::sweep)
+  struct SweepPoint
+  {
+    // (index of the constraint, new bound) see ScaLP::Solver::setConstraintBound
+    std::vector<std::pair<std::size_t,double>> bounds;
+    // new coefficients in the objective
+    std::map<ScaLP::Variable,double> objective;
+  };
+
   class Solver
   {
     public:
@@ -42,6 +82,17 @@ namespace ScaLP
       // e. g. timeout = 2_hours + 15_minutes + 30_seconds
       long timeout = 0;
 
+      // deadline of the whole solve (construction of the model, the
+      // result-cache and the backend), the backend gets the remaining time
+      // but at most timeout. If it is reached before the backend runs, the
+      // solve stops with TIMEOUT_INFEASIBLE, or TIMEOUT_FEASIBLE with the
+      // warm-start values (if feasible) or a cached solution.
+      // time_point::max() is no deadline.
+      std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+      // set the deadline to seconds from now
+      void setDeadline(double seconds);
+
       //integer feasible tolerance
       //if difference of a variable to the nearest integer value is less than intFeasTol, it is regarded as integral
       double intFeasTol = -1;
@@ -55,10 +106,35 @@ namespace ScaLP
 
       // Threads used by the solver (0 means auto-detection)
       int threads = 0;
+
+      // share the threads with concurrent solves (see ScaLP::ThreadScheduler).
+      // The solve waits for an allocation of the scheduler and uses its
+      // threads, threads is the maximum then. A wait beyond the timeout or the
+      // deadline ends the solve with TIMEOUT_FEASIBLE or TIMEOUT_INFEASIBLE.
+      ScaLP::ThreadScheduler* scheduler = nullptr;
+
+      // priority of the solve in the scheduler (higher is served first)
+      int priority = 0;
       
       // use a warm-start, if possible
       bool warmStart = false;
 
+      // compute the dual values and reduced costs of LPs (see ScaLP::Result)
+      bool dualValues = false;
+
+      // solve the connected components of the model (groups of constraints
+      // without common variables) as separate models in parallel.
+      // The results are merged: objective values are added and the status is
+      // the worst of the components.
+      // Solves with a progress callback and solveAsync (which cancels the
+      // backend of this solver) always solve the whole model.
+      bool decompose = false;
+
+      // the workers for the components (with their own parameters).
+      // Without a pool, a temporary one with the backends of the constructor
+      // is used.
+      ScaLP::SolverPool* pool = nullptr;
+
 
 
       //####################
@@ -68,12 +144,63 @@ namespace ScaLP
       // set the (new) objective
       void setObjective(const Objective& o);
 
+      // set lexicographic objectives: solve() optimizes the first one, then
+      // every following one with the previous ones fixed to their optima.
+      // tolerances[i] is the relative deterioration of the optimum of the
+      // i-th objective allowed in the later stages (default 0).
+      // The stages share the backend, the fixing constraints are passed as
+      // changes and every stage starts from the solution of the previous one.
+      // setObjective replaces them by a single objective.
+      void setObjectives(const std::vector<ScaLP::Objective>& os, const std::vector<double>& tolerances={});
+
       // add a constraint
       void addConstraint(Constraint& b);
       void addConstraint(Constraint&& b);
 
+      // move the constraints and objective terms of the shards into the model.
+      // The constraints are appended in the order of the shards, so the
+      // resulting model does not depend on how the shards were filled.
+      // Objective terms are added to the current objective.
+      // Throws (without changing the model) if two different variables share a
+      // name. The shards are empty afterwards.
+      void merge(std::vector<ScaLP::ModelBuilder>&& shards);
+      void merge(ScaLP::ModelBuilder&& shard);
+
       bool load(const std::string& file);
 
+      // add a new variable with coefficients in existing constraints.
+      // Backends with incremental support get only the new column.
+      // (the coefficients are not undone by pop)
+      void addColumn(const ScaLP::Column& c);
+
+      // change the bounds of a variable
+      // (inside a scope the old bounds are restored by pop)
+      void setBounds(const ScaLP::Variable& v, double lb, double ub);
+
+      // change the constant of the i-th constraint (index in getConstraints()),
+      // e.g. d in "term <= d", "d <= term" or "term == d".
+      // Use setConstraintBounds for ranges "lb <= term <= ub".
+      // (inside a scope the old bounds are restored by pop)
+      void setConstraintBound(std::size_t i, double d);
+      void setConstraintBounds(std::size_t i, double lb, double ub);
+
+
+      //####################
+      // Scopes
+      //####################
+
+      // open a new scope.
+      // Bound changes and constraints added after push are undone by the
+      // matching pop. Backends with incremental support apply these changes
+      // as deltas instead of rebuilding the whole model.
+      void push();
+
+      // undo all changes since the last push
+      void pop();
+
+      // the number of open scopes
+      std::size_t getScopeDepth() const;
+
 
       //####################
       // Solving
@@ -86,9 +213,68 @@ namespace ScaLP
       // solve, use the given solution for warm-start
       ScaLP::status solve(const ScaLP::Result& start);
 
+      // run solve() in another thread.
+      // The handle can cancel the solve and shows the latest incumbent.
+      // The model is not decomposed (see decompose).
+      ScaLP::SolveHandle solveAsync();
+
       // solve without cache
       ScaLP::status newSolve();
 
+      // f is called by the backend (in the solving thread) with the progress
+      // of the solve, e.g. for new incumbents and bound updates.
+      // The solve stops if f returns false, an exception of f stops it and
+      // is thrown by solve(). Backends without progress events (lp_solve)
+      // report at most every 0.1 seconds besides new incumbents.
+      // (an empty function removes the callback)
+      void setProgressCallback(ScaLP::ProgressCallback f);
+
+      // solve with lazily generated constraints:
+      // f gets the (integer or fractional) solutions found and returns
+      // the constraints violated by them. If the backend supports it, f is
+      // called while solving, otherwise the model is solved again with the
+      // new constraints until f returns nothing (at most maxRounds times,
+      // then UNKNOWN is returned).
+      // The generated constraints are added to the model.
+      ScaLP::status solveWithSeparator(ScaLP::Separator f, std::size_t maxRounds=1000);
+
+      // column generation: solve the LP (the restricted master) with dual
+      // values and add the columns of f with improving reduced costs until
+      // there are none (at most maxRounds times, then UNKNOWN is returned).
+      // The columns are added to the model.
+      ScaLP::status solveWithColumnGeneration(ScaLP::Pricer f, std::size_t maxRounds=1000);
+
+      // solve the LP relaxation: the backend treats every variable as real
+      // (the variables are unchanged). getResult() holds the fractional
+      // solution. The objective value of an optimal relaxation is stored as
+      // bound (see getRelaxationBound), later solves report the gap to it in
+      // ScaLP::SolveStatistics until the model is changed in a way which
+      // could loosen it (objective, bounds, pop, columns).
+      ScaLP::status solveRelaxation();
+
+      // the bound of the last solveRelaxation (NaN if none or outdated)
+      double getRelaxationBound() const;
+
+      // parametric sweep: solve the model with the changes of every point.
+      // The points do not accumulate, the model is unchanged afterwards.
+      // The changes are passed to the backend in place and every point starts
+      // from the solution of the previous one (if the backend supports it).
+      // With more than one worker, the points are split into contiguous
+      // chunks, each solved by a new backend (of the names of the
+      // constructor) in its own thread.
+      std::vector<std::pair<ScaLP::status,ScaLP::Result>> sweep(const std::vector<ScaLP::SweepPoint>& ps, unsigned int workers=1);
+
+      // the k best solutions (all if k is 0) of a model with binary and real
+      // variables, which differ in the binary variables.
+      // Only solutions within the relative gapTolerance of the optimum are
+      // returned, so gapTolerance 0 gives all optimal solutions.
+      // The solutions stored by the backend (see
+      // ScaLP::SolverBackend::setSolutionPool) are taken if they are as good
+      // as the best remaining one, the found solutions are excluded by
+      // no-good cuts passed to the backend as changes.
+      // The model is unchanged afterwards, getResult() is the optimum.
+      ScaLP::SolutionPool enumerate(std::size_t k, double gapTolerance=0);
+
       ScaLP::Result getResult();
 
 
@@ -136,6 +322,17 @@ namespace ScaLP
 
         // prefer cached values if possible, instead of solving
         bool preferCachedValues = false;
+
+        // write every new incumbent of a running solve (with the time and
+        // the bound) into the entry. A solve of the same model starts from
+        // the checkpoint, e.g. after the process was killed. A finished solve
+        // keeps it as feasible solution.
+        // (needs a backend with progress callbacks)
+        bool checkpoints = false;
+
+        // at least this number of seconds between two checkpoints
+        // (an incumbent inside the interval is written with the next report)
+        double checkpointInterval = 0;
       } resultCache;
 
       // set the directory for the Result-Cache
@@ -166,6 +363,11 @@ namespace ScaLP
       // returns the no of variables used in constraint and objective so far
       int getVariableCount();
 
+      // returns figures about the size and numerics of the model.
+      // They are updated while the model is built, only the extreme values are
+      // recomputed after constraints were removed or bounds were changed.
+      const ScaLP::ModelStatistics& statistics();
+
       // return the LP-Format-representation as a string
       std::string showLP() const;
 
@@ -182,6 +384,10 @@ namespace ScaLP
       // The used objective
       Objective objective;
 
+      // the stages of lexicographic objectives (empty for a single objective)
+      std::vector<ScaLP::Objective> objectives;
+      std::vector<double> objectiveTolerances;
+
       // The used constraints
       std::vector<Constraint> cons;
 
@@ -192,17 +398,82 @@ namespace ScaLP
 
       ScaLP::Result warmStartValues;
 
+      ScaLP::ProgressCallback progressCallback;
+
+      // the backends requested in the constructor (for decompose)
+      std::list<ScaLP::Feature> backendFeatures;
+      std::list<std::string> backendNames;
+
       bool modelChanged=true;
 
       double absMIPGap=-1;
       double relMIPGap=-1;
 
+      // the changes recorded since a push (old bounds and the number of
+      // constraints before the push)
+      struct Scope
+      {
+        std::size_t constraintCount;
+        std::vector<std::tuple<ScaLP::Variable,double,double>> bounds;
+        std::vector<std::tuple<std::size_t,double,double>> constraintBounds;
+      };
+      std::vector<Scope> scopes;
+
+      // the state of the model inside the backend
+      bool constructed=false;                 // the backend holds a model
+      std::size_t constructedConstraints=0;   // cons[0..n) are in the backend
+      std::size_t removedConstraints=0;       // constraints to remove from the backend
+      bool objectiveChanged=false;            // the objective has to be replaced
+      ScaLP::VariableSet constructedVariables;
+      std::vector<ScaLP::Variable> changedBounds;
+      std::vector<std::size_t> changedConstraints;  // constructed constraints with new bounds
+      std::vector<ScaLP::Column> newColumns;  // columns of constructed constraints
+
+      // the objective value of the last relaxation (see solveRelaxation)
+      double relaxationBound=std::numeric_limits<double>::quiet_NaN();
+      bool relaxing=false; // solveRelaxation is running
+
+      // solveAsync is running (the backend of this solver has to solve)
+      bool solvingAsync=false;
+
+      // the backend has a time limit of a previous solve
+      bool timeLimited=false;
+
+      // the duration of the last rebuild and the size of the rebuilt model
+      // (used to estimate the time saved by updates)
+      double rebuildTime=0;
+      std::size_t rebuildNonzeros=0;
+
+      // the statistics and the number of uses of each variable
+      ScaLP::ModelStatistics stats;
+      std::unordered_map<const ScaLP::VariableBase*,std::size_t> variableUses;
+      bool statisticsOutdated=false;  // the extreme values need a recomputation
+
+      void countVariables(const ScaLP::Term& t, bool add);
+      void countConstraint(const ScaLP::Constraint& c, bool add);
+      void resetStatistics();
+
       ScaLP::status newSolve(const ScaLP::VariableSet& vs);
+      void changeConstraintBounds(std::size_t i, double lb, double ub);
+      // solve the stages of objectives (see setObjectives)
+      ScaLP::status solveLexicographic();
+      // solve the points in order (see sweep)
+      std::vector<std::pair<ScaLP::status,ScaLP::Result>> sweepSequential(const std::vector<ScaLP::SweepPoint>& ps);
+      // solve the components (indices of their constraints) in parallel
+      ScaLP::status solveComponents(const std::vector<std::vector<std::size_t>>& components);
+      // solve using the result-cache, records the durations of the cache
+      ScaLP::status solveCached(const ScaLP::VariableSet& vs, ScaLP::Timings& timings);
       void writeLP(std::string file, const ScaLP::VariableSet& vs) const;
       void prepare();
+      // pass the remaining time to the backend
+      void limitTime();
+      // stop a solve which reached the deadline before the backend ran
+      ScaLP::status stopAtDeadline(const ScaLP::VariableSet& vs, ScaLP::Result& res);
       void construct();
       void construct(const ScaLP::VariableSet& vs);
       void construct(const std::string& file);
+      bool updatable(const ScaLP::VariableSet& vs, ScaLP::VariableSet& added) const;
+      void update(const ScaLP::VariableSet& vs, const ScaLP::VariableSet& added);
       void postprocess();
 
   };
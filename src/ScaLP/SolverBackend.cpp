@@ -1,5 +1,7 @@
 #include <ScaLP/SolverBackend.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include <ScaLP/Exception.h>
@@ -70,6 +72,13 @@ void ScaLP::SolverBackend::setTimeout(long t)
   throw ScaLP::Exception("Scalp: You need to implement the setTimeout function in the backend.");
 }
 
+void ScaLP::SolverBackend::setTimeLimit(double seconds)
+{
+  // zero is no limit for setTimeout
+  if(std::isinf(seconds)) setTimeout(0);
+  else setTimeout(std::max(1L,static_cast<long>(std::ceil(seconds))));
+}
+
 void ScaLP::SolverBackend::setIntFeasTol(double intFeasTol)
 {
   (void)(intFeasTol);
@@ -105,6 +114,101 @@ void ScaLP::SolverBackend::setStartValues(const ScaLP::Result& start)
   std::cerr << "Scalp: Warm-start not supported by this backend, ignore it." << std::endl;
 }
 
+bool ScaLP::SolverBackend::setVariableBounds(const ScaLP::Variable& v, double lb, double ub)
+{
+  (void)(v);
+  (void)(lb);
+  (void)(ub);
+  return false;
+}
+
+bool ScaLP::SolverBackend::setConstraintBounds(std::size_t i, const ScaLP::Constraint& c)
+{
+  (void)(i);
+  (void)(c);
+  return false;
+}
+
+bool ScaLP::SolverBackend::removeConstraints(std::size_t n)
+{
+  (void)(n);
+  return false;
+}
+
+bool ScaLP::SolverBackend::updateObjective(ScaLP::Objective o)
+{
+  (void)(o);
+  return false;
+}
+
+bool ScaLP::SolverBackend::addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients)
+{
+  (void)(v);
+  (void)(obj);
+  (void)(coefficients);
+  return false;
+}
+
+bool ScaLP::SolverBackend::setDualValues(bool d)
+{
+  (void)(d);
+  return false;
+}
+
+bool ScaLP::SolverBackend::interrupt()
+{
+  return false;
+}
+
+void ScaLP::SolverBackend::clearInterrupt()
+{
+}
+
+void ScaLP::SolverBackend::setIncumbentCallback(std::function<void(const ScaLP::Result&)> f)
+{
+  incumbentCallback=f;
+}
+
+bool ScaLP::SolverBackend::setObjectiveCutoff(double d)
+{
+  (void)(d);
+  return false;
+}
+
+bool ScaLP::SolverBackend::setProgressCallback(ScaLP::ProgressCallback f)
+{
+  progressCallback=f;
+  return false;
+}
+
+bool ScaLP::SolverBackend::setSeparator(ScaLP::Separator f)
+{
+  (void)(f);
+  return false;
+}
+
+bool ScaLP::SolverBackend::setSolutionPool(std::size_t n)
+{
+  (void)(n);
+  return false;
+}
+
+std::vector<ScaLP::Result> ScaLP::SolverBackend::getSolutions()
+{
+  return {};
+}
+
+bool ScaLP::SolverBackend::setRelaxation(bool r)
+{
+  relaxation=r;
+  return false;
+}
+
+ScaLP::VariableType ScaLP::SolverBackend::typeOf(const ScaLP::Variable& v) const
+{
+  return relaxation ? ScaLP::VariableType::REAL : v->getType();
+}
+
 bool ScaLP::SolverBackend::featureSupported(ScaLP::Feature f) const
 {
   switch(f)
@@ -116,6 +220,7 @@ bool ScaLP::SolverBackend::featureSupported(ScaLP::Feature f) const
     case ScaLP::Feature::INDICATOR_CONSTRAINTS : return this->features.indicators;
     case ScaLP::Feature::LOGICAL_OPERATORS : return this->features.logical;
     case ScaLP::Feature::WARMSTART : return this->features.warmstart;
+    case ScaLP::Feature::INCREMENTAL : return this->features.incremental;
   }
   return false;
 }
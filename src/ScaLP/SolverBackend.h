@@ -20,8 +20,13 @@ namespace ScaLP
   , INDICATOR_CONSTRAINTS
   , LOGICAL_OPERATORS
   , WARMSTART
+  , INCREMENTAL
   };
 
+  // gets an (integer or fractional) solution and returns constraints which
+  // are violated by it, nothing if it is feasible
+  using Separator = std::function<std::vector<ScaLP::Constraint>(const ScaLP::Result&)>;
+
   class Features
   {
     public:
@@ -32,6 +37,7 @@ namespace ScaLP
     bool indicators=false;
     bool logical=false;
     bool warmstart=false;
+    bool incremental=false;
   };
 
   class SolverBackend
@@ -50,12 +56,88 @@ namespace ScaLP
       virtual void reset();
       virtual void setConsoleOutput(bool verbose);
       virtual void setTimeout(long timeout);
+      // time limit in seconds with sub-second precision, infinity removes it
+      // (the default rounds up to whole seconds for setTimeout)
+      virtual void setTimeLimit(double seconds);
       virtual void setIntFeasTol(double intFeasTol);
       virtual void presolve(bool presolve);
       virtual void setThreads(unsigned int t);
       virtual void setRelativeMIPGap(double d);
       virtual void setAbsoluteMIPGap(double d);
       virtual void setStartValues(const ScaLP::Result& start);
+      // fill ScaLP::Result::duals after solving LPs,
+      // returns false if not supported
+      virtual bool setDualValues(bool d);
+
+      //####################
+      // modification of an already constructed model
+      // (only used if features.incremental is set)
+      //####################
+      // change the bounds of an already added variable
+      virtual bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub);
+      // change the bounds of the i-th added constraint to those of c
+      // (only the bounds differ)
+      virtual bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c);
+      // remove the n most recently added constraints
+      virtual bool removeConstraints(std::size_t n);
+      // replace the objective, coefficients of variables not in o become zero
+      virtual bool updateObjective(ScaLP::Objective o);
+      // add the new variable v with the objective coefficient obj and the
+      // coefficients (index of the constraint, value) in added constraints
+      virtual bool addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients);
+
+      //####################
+      // interruption and incumbents
+      // (interrupt, clearInterrupt and setObjectiveCutoff may be called from
+      //  another thread while solve() runs)
+      //####################
+      // stop the running (or the next) solve as soon as possible,
+      // returns false if interruption is not supported
+      virtual bool interrupt();
+      // withdraw an interruption request
+      virtual void clearInterrupt();
+      // f is called from the solving thread for every new incumbent
+      virtual void setIncumbentCallback(std::function<void(const ScaLP::Result&)> f);
+      // only solutions better than d are of interest for the running solve
+      // (a solve which finds none may report INFEASIBLE),
+      // returns false if not supported
+      virtual bool setObjectiveCutoff(double d);
+      // f is called from the solving thread to report the progress of the
+      // solve, the solve stops if f returns false.
+      // returns false if not supported
+      virtual bool setProgressCallback(ScaLP::ProgressCallback f);
+
+      //####################
+      // lazy constraints
+      //####################
+      // f is called from the solving thread with the solutions of the
+      // running solve and the violated constraints it returns are added to
+      // it (they may only use variables of the model).
+      // The constraints are forgotten after the solve.
+      // (an empty function removes the separator)
+      // returns false if not supported
+      virtual bool setSeparator(ScaLP::Separator f);
+
+      //####################
+      // solution pool
+      //####################
+      // keep up to n solutions of the following solves instead of only the
+      // best one (0 restores the default of the backend).
+      // returns false if not supported
+      virtual bool setSolutionPool(std::size_t n);
+      // the solutions stored by the last solve (including the returned one),
+      // best first. Empty if not supported.
+      virtual std::vector<ScaLP::Result> getSolutions();
+
+      //####################
+      // relaxation
+      //####################
+      // treat every variable as real (see ScaLP::Solver::solveRelaxation)
+      // without changing the variables. Variables added afterwards get the
+      // type of typeOf, so a rebuilt model is relaxed.
+      // Returns true if the added variables were changed in place,
+      // otherwise the model has to be rebuilt.
+      virtual bool setRelaxation(bool r);
 
       Features features;
       bool featureSupported(ScaLP::Feature f) const;
@@ -76,6 +158,13 @@ namespace ScaLP
       {
       }
 
+      std::function<void(const ScaLP::Result&)> incumbentCallback;
+      ScaLP::ProgressCallback progressCallback;
+
+      // the type of v in the model of the backend (REAL in a relaxation)
+      bool relaxation=false;
+      ScaLP::VariableType typeOf(const ScaLP::Variable& v) const;
+
   };
 
 }
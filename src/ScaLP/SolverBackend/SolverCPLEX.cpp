@@ -4,6 +4,7 @@
 
 #include <ScaLP/Result.h>
 
+#include <cmath>
 #include <tuple>
 
 ScaLP::SolverBackend* newSolverCPLEX()
@@ -29,9 +30,9 @@ ScaLP::SolverCPLEX::SolverCPLEX()
   this->features.warmstart=true;
 }
 
-static IloNumVar::Type mapVariableType(const ScaLP::Variable& v)
+static IloNumVar::Type mapVariableType(ScaLP::VariableType t)
 {
-  switch(v->getType())
+  switch(t)
   {
     case ScaLP::VariableType::BINARY: return IloNumVar::Bool;
     case ScaLP::VariableType::INTEGER: return IloNumVar::Int;
@@ -45,7 +46,7 @@ bool ScaLP::SolverCPLEX::addVariable(const ScaLP::Variable& v)
 {
   bool r=false;
   try{
-    auto p = variables.emplace(v,IloNumVar(env,v->getLowerBound(), v->getUpperBound(),mapVariableType(v),v->getName().c_str()));
+    auto p = variables.emplace(v,IloNumVar(env,v->getLowerBound(), v->getUpperBound(),mapVariableType(typeOf(v)),v->getName().c_str()));
     r=p.second;
   }
   catch(IloException& e)
@@ -266,6 +267,29 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverCPLEX::solve()
       stat = mapStatus(cplex.getCplexStatus(),false);
     }
 
+    // statistics (the time of the first solution needs a callback)
+    try
+    {
+      res.statistics.iterations = cplex.getNiterations();
+      if(cplex.isMIP())
+      {
+        res.statistics.nodes = cplex.getNnodes();
+        res.statistics.solutions = cplex.getSolnPoolNsolns();
+        res.statistics.dualBound = cplex.getBestObjValue()+objectiveOffset;
+        if(not res.values.empty()) res.statistics.gap = cplex.getMIPRelativeGap();
+      }
+      else if(stat==ScaLP::status::OPTIMAL)
+      {
+        res.statistics.solutions = 1;
+        res.statistics.dualBound = res.objectiveValue;
+        res.statistics.gap = 0;
+      }
+    }
+    catch(IloException&)
+    {
+      // not available for this model, keep the rest
+    }
+
   }
   catch(IloCplex::Exception& e)
   {
@@ -315,6 +339,11 @@ void ScaLP::SolverCPLEX::setTimeout(long timeout)
   this->timeout=timeout;
 }
 
+void ScaLP::SolverCPLEX::setTimeLimit(double seconds)
+{
+  this->timeout=std::isinf(seconds)?0:seconds;
+}
+
 void ScaLP::SolverCPLEX::presolve(bool presolve)
 {
   try
@@ -44,6 +44,7 @@ namespace ScaLP
       virtual void reset() override;
       virtual void setConsoleOutput(bool verbose) override;
       virtual void setTimeout(long timeout) override;
+      virtual void setTimeLimit(double seconds) override;
       virtual void presolve(bool presolve) override;
       virtual void setThreads(unsigned int t) override;
       virtual void setRelativeMIPGap(double d) override;
@@ -54,7 +55,7 @@ namespace ScaLP
       IloModel model;
       std::map<ScaLP::Variable,IloNumVar> variables;
       bool verbose=true;
-      long timeout=0;
+      double timeout=0;
       bool presolving=false;
       unsigned int threads=0;
 
@@ -1,5 +1,6 @@
 
 #include <ScaLP/SolverBackend/SolverDynamic.h>
+#include <ScaLP/SolverBackend/SolverPortfolio.h>
 #include <ScaLP/SolverBackend.h>
 
 #include <ScaLP/Exception.h>
@@ -41,9 +42,10 @@ namespace ScaLP
 class SolverDynamic : public SolverBackend
 {
   public:
-  SolverDynamic(std::list<ScaLP::Feature>fs, std::list<std::string> lsa)
+  SolverDynamic(std::list<ScaLP::Feature>fs, std::list<std::string> lsa, bool environment=true)
   {
-    std::list<std::string> ls= getEnvironment();
+    std::list<std::string> ls;
+    if(environment) ls=getEnvironment();
     ls.splice(ls.end(),lsa);
     ls.unique();
 
@@ -55,6 +57,15 @@ class SolverDynamic : public SolverBackend
       // skip empty entries
       if(name.empty()) continue;
 
+      // a portfolio of backends, e.g. "Portfolio:SCIP,LPSolve"
+      if(name.compare(0,portfolioPrefix.size(),portfolioPrefix)==0)
+      {
+        back=newPortfolio(fs,name.substr(portfolioPrefix.size()));
+        if(back==nullptr) continue;
+        this->features=back->features;
+        break;
+      }
+
       dlerror(); // free error message
       handle = dlopen(("libScaLP-"+name+LIBRARY_SUFFIX).c_str(),RTLD_NOW);
       
@@ -118,7 +129,7 @@ class SolverDynamic : public SolverBackend
   ~SolverDynamic()
   {
     if(back!=nullptr) delete back;
-    dlclose(library);
+    if(library!=nullptr) dlclose(library);
   }
 
   bool addVariable(const ScaLP::Variable& v) override
@@ -162,6 +173,10 @@ class SolverDynamic : public SolverBackend
   {
     back->setTimeout(timeout);
   }
+  void setTimeLimit(double seconds) override
+  {
+    back->setTimeLimit(seconds);
+  }
   void setIntFeasTol(double intFeasTol) override
   {
     back->setIntFeasTol(intFeasTol);
@@ -186,10 +201,96 @@ class SolverDynamic : public SolverBackend
   {
     back->setStartValues(start);
   }
+  bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub) override
+  {
+    return back->setVariableBounds(v,lb,ub);
+  }
+  bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c) override
+  {
+    return back->setConstraintBounds(i,c);
+  }
+  bool removeConstraints(std::size_t n) override
+  {
+    return back->removeConstraints(n);
+  }
+  bool updateObjective(ScaLP::Objective o) override
+  {
+    return back->updateObjective(o);
+  }
+  bool interrupt() override
+  {
+    return back->interrupt();
+  }
+  void clearInterrupt() override
+  {
+    back->clearInterrupt();
+  }
+  void setIncumbentCallback(std::function<void(const ScaLP::Result&)> f) override
+  {
+    back->setIncumbentCallback(f);
+  }
+  bool setObjectiveCutoff(double d) override
+  {
+    return back->setObjectiveCutoff(d);
+  }
+  bool setProgressCallback(ScaLP::ProgressCallback f) override
+  {
+    return back->setProgressCallback(f);
+  }
+  bool setDualValues(bool d) override
+  {
+    return back->setDualValues(d);
+  }
+  bool addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients) override
+  {
+    return back->addColumn(v,obj,coefficients);
+  }
+  bool setSeparator(ScaLP::Separator f) override
+  {
+    return back->setSeparator(f);
+  }
+  bool setSolutionPool(std::size_t n) override
+  {
+    return back->setSolutionPool(n);
+  }
+  std::vector<ScaLP::Result> getSolutions() override
+  {
+    return back->getSolutions();
+  }
+  bool setRelaxation(bool r) override
+  {
+    return back->setRelaxation(r);
+  }
 
   private:
   SolverBackend* back=nullptr;
-  void* library;
+  void* library=nullptr;
+
+  const std::string portfolioPrefix="Portfolio:";
+
+  // load the comma-separated backends, skip the unavailable ones
+  static SolverBackend* newPortfolio(std::list<ScaLP::Feature> fs, const std::string& names)
+  {
+    std::vector<ScaLP::SolverBackend*> members;
+    std::stringstream s;
+    s.str(names);
+    std::string entry;
+    while(std::getline(s,entry,','))
+    {
+      if(entry.empty()) continue;
+      try
+      {
+        members.push_back(new SolverDynamic(fs,{entry},false));
+      }
+      catch(ScaLP::Exception& e)
+      {
+        std::cerr << "ScaLP: Portfolio: " << e.what() << " (" << entry << ")" << std::endl;
+      }
+    }
+
+    if(members.empty()) return nullptr;
+    return ScaLP::newSolverPortfolio(members);
+  }
 };
 
 } // namespace ScaLP
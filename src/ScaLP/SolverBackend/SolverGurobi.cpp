@@ -2,6 +2,7 @@
 #include <ScaLP/SolverBackend/SolverGurobi_intern.h>
 #include <ScaLP/SolverBackend/SolverGurobi.h>
 
+#include <algorithm>
 #include <limits>
 #include <cmath>
 
@@ -33,6 +34,9 @@ try :environment(GRBEnv()), model(GRBModel(environment))
   #endif
   this->features.logical=false;
   this->features.warmstart=true;
+  this->features.incremental=true;
+
+  model.setCallback(&callback);
 }
 catch(GRBException e)
 {
@@ -55,7 +59,7 @@ bool ScaLP::SolverGurobi::addVariable(const ScaLP::Variable& v)
   GRBVar grbv;
   try
   {
-    grbv = model.addVar(mapValue(v->getLowerBound()),mapValue(v->getUpperBound()),0,variableType(v->getType()),v->getName());
+    grbv = model.addVar(mapValue(v->getLowerBound()),mapValue(v->getUpperBound()),0,variableType(typeOf(v)),v->getName());
   }
   catch(GRBException e)
   {
@@ -115,6 +119,7 @@ static ScaLP::relation flipRelation(ScaLP::relation r)
 
 bool ScaLP::SolverGurobi::addConstraint(const ScaLP::Constraint& cons)
 {
+  BackendConstraint added;
   try
   {
     // TODO: check if avoiding temporary constraints increase performance
@@ -123,22 +128,22 @@ bool ScaLP::SolverGurobi::addConstraint(const ScaLP::Constraint& cons)
       switch(cons.ctype)
       {
         case ScaLP::Constraint::type::C2L:
-          model.addConstr(cons.lbound,mapRelation(cons.lrel),mapTerm(cons.term),cons.name);
+          added.linear.push_back(model.addConstr(cons.lbound,mapRelation(cons.lrel),mapTerm(cons.term),cons.name));
           break;
         case ScaLP::Constraint::type::C2R:
-          model.addConstr(mapTerm(cons.term),mapRelation(cons.rrel),cons.ubound,cons.name);
+          added.linear.push_back(model.addConstr(mapTerm(cons.term),mapRelation(cons.rrel),cons.ubound,cons.name));
           break;
         case ScaLP::Constraint::type::CEQ:
-          model.addConstr(cons.lbound,mapRelation(cons.lrel),mapTerm(cons.term),cons.name);
+          added.linear.push_back(model.addConstr(cons.lbound,mapRelation(cons.lrel),mapTerm(cons.term),cons.name));
           break;
         case ScaLP::Constraint::type::C3:
           if(cons.lrel==ScaLP::relation::LESS_EQ_THAN)
           { // d <= x <= d
-            model.addRange(mapTerm(cons.term),cons.lbound,cons.ubound,cons.name);
+            added.linear.push_back(model.addRange(mapTerm(cons.term),cons.lbound,cons.ubound,cons.name));
           }
           else
           { // d >= x >= d
-            model.addRange(mapTerm(cons.term),cons.ubound,cons.lbound,cons.name);
+            added.linear.push_back(model.addRange(mapTerm(cons.term),cons.ubound,cons.lbound,cons.name));
           }
           break;
       }
@@ -158,17 +163,17 @@ bool ScaLP::SolverGurobi::addConstraint(const ScaLP::Constraint& cons)
       switch(cons.ctype)
       {
         case ScaLP::Constraint::type::C2L:
-          model.addGenConstrIndicator(var,val,t,mapRelation(flipRelation(cons.lrel)),cons.lbound,cons.name);
+          added.general.push_back(model.addGenConstrIndicator(var,val,t,mapRelation(flipRelation(cons.lrel)),cons.lbound,cons.name));
           break;
         case ScaLP::Constraint::type::C2R:
-          model.addGenConstrIndicator(var,val,t,mapRelation(cons.rrel),cons.ubound,cons.name);
+          added.general.push_back(model.addGenConstrIndicator(var,val,t,mapRelation(cons.rrel),cons.ubound,cons.name));
           break;
         case ScaLP::Constraint::type::CEQ:
-          model.addGenConstrIndicator(var,val,t,mapRelation(cons.lrel),cons.lbound,cons.name);
+          added.general.push_back(model.addGenConstrIndicator(var,val,t,mapRelation(cons.lrel),cons.lbound,cons.name));
           break;
         case ScaLP::Constraint::type::C3:
-          model.addGenConstrIndicator(var,val,t,mapRelation(flipRelation(cons.lrel)),cons.lbound,cons.name+"_l");
-          model.addGenConstrIndicator(var,val,t,mapRelation(cons.rrel),cons.ubound,cons.name+"_r");
+          added.general.push_back(model.addGenConstrIndicator(var,val,t,mapRelation(flipRelation(cons.lrel)),cons.lbound,cons.name+"_l"));
+          added.general.push_back(model.addGenConstrIndicator(var,val,t,mapRelation(cons.rrel),cons.ubound,cons.name+"_r"));
           break;
       }
     #endif
@@ -178,6 +183,7 @@ bool ScaLP::SolverGurobi::addConstraint(const ScaLP::Constraint& cons)
   {
     throw ScaLP::Exception("Error while adding a Constraint to the backend: "+e.getMessage());
   }
+  constraints.push_back(std::move(added));
   return true;
 }
 
@@ -203,12 +209,16 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverGurobi::solve()
   ScaLP::Result res;
   try
   {
+    firstIncumbentTime=-1;
+    stopped=false;
+    callbackError=nullptr;
     model.optimize();
+    if(callbackError) std::rethrow_exception(callbackError);
 
   
     int grbStatus = model.get(GRB_IntAttr_Status);
 
-    if(grbStatus == GRB_OPTIMAL or grbStatus == GRB_SUBOPTIMAL or grbStatus == GRB_TIME_LIMIT)
+    if(grbStatus == GRB_OPTIMAL or grbStatus == GRB_SUBOPTIMAL or grbStatus == GRB_TIME_LIMIT or grbStatus == GRB_INTERRUPTED)
     {
       if(model.get(GRB_IntAttr_SolCount)>0)
       {
@@ -220,6 +230,8 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverGurobi::solve()
       }
     }
 
+    res.statistics = statistics(grbStatus,res);
+
     if(grbStatus == GRB_OPTIMAL) return {ScaLP::status::OPTIMAL,res};
     if(grbStatus == GRB_UNBOUNDED) return {ScaLP::status::UNBOUND,res};
     if(grbStatus == GRB_SUBOPTIMAL) return {ScaLP::status::FEASIBLE,res};
@@ -228,6 +240,9 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverGurobi::solve()
     if(grbStatus == GRB_TIME_LIMIT) return {ScaLP::status::TIMEOUT_INFEASIBLE,res};
     if(grbStatus == GRB_INFEASIBLE) return {ScaLP::status::INFEASIBLE,res};
     if(grbStatus == GRB_INF_OR_UNBD) return {ScaLP::status::INFEASIBLE_OR_UNBOUND,res};
+    if(grbStatus == GRB_INTERRUPTED and model.get(GRB_IntAttr_SolCount)>0)
+      return {ScaLP::status::CANCELLED_FEASIBLE,res};
+    if(grbStatus == GRB_INTERRUPTED) return {ScaLP::status::CANCELLED_INFEASIBLE,res};
   }
   catch(GRBException e)
   {
@@ -237,6 +252,33 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverGurobi::solve()
   return {ScaLP::status::ERROR,res};
 }
 
+ScaLP::SolveStatistics ScaLP::SolverGurobi::statistics(int grbStatus, const ScaLP::Result& res)
+{
+  ScaLP::SolveStatistics st;
+  try
+  {
+    st.solutions = model.get(GRB_IntAttr_SolCount);
+    st.iterations = static_cast<long long>(model.get(GRB_DoubleAttr_IterCount));
+    st.firstIncumbentTime = firstIncumbentTime;
+    if(model.get(GRB_IntAttr_IsMIP))
+    {
+      st.nodes = static_cast<long long>(model.get(GRB_DoubleAttr_NodeCount));
+      st.dualBound = model.get(GRB_DoubleAttr_ObjBound)+objectiveOffset;
+      if(st.solutions>0) st.gap = model.get(GRB_DoubleAttr_MIPGap);
+    }
+    else if(grbStatus==GRB_OPTIMAL)
+    {
+      st.dualBound = res.objectiveValue;
+      st.gap = 0;
+    }
+  }
+  catch(GRBException&)
+  {
+    // not available for this model, keep the rest
+  }
+  return st;
+}
+
 GRBLinExpr ScaLP::SolverGurobi::mapTerm(ScaLP::Term t)
 {
   GRBLinExpr expr = t.constant;
@@ -277,6 +319,7 @@ void ScaLP::SolverGurobi::reset()
 {
   // clear the variables-cache
   variables.clear();
+  constraints.clear();
   objectiveOffset=0;
 
   // reset Gurobi itself
@@ -284,6 +327,7 @@ void ScaLP::SolverGurobi::reset()
   {
     model.~GRBModel();
     new (&model) GRBModel(environment);
+    model.setCallback(&callback);
   }catch(GRBException &e)
   {
     throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
@@ -312,6 +356,17 @@ void ScaLP::SolverGurobi::setTimeout(long timeout)
   }
 }
 
+void ScaLP::SolverGurobi::setTimeLimit(double seconds)
+{
+  try
+  {
+    model.getEnv().set(GRB_DoubleParam_TimeLimit,std::isinf(seconds)?GRB_INFINITY:seconds);
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+}
+
 void ScaLP::SolverGurobi::setIntFeasTol(double intFeasTol)
 {
   try
@@ -389,3 +444,227 @@ void ScaLP::SolverGurobi::setStartValues(const ScaLP::Result& start)
     }
   }
 }
+
+bool ScaLP::SolverGurobi::setVariableBounds(const ScaLP::Variable& v, double lb, double ub)
+{
+  auto it = variables.find(v);
+  if(it==variables.end()) return false;
+
+  try
+  {
+    it->second.set(GRB_DoubleAttr_LB,mapValue(lb));
+    it->second.set(GRB_DoubleAttr_UB,mapValue(ub));
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return true;
+}
+
+bool ScaLP::SolverGurobi::setConstraintBounds(std::size_t i, const ScaLP::Constraint& c)
+{
+  // ranges have an additional variable and indicators no right hand side
+  if(i>=constraints.size() or c.indicator!=nullptr or c.ctype==ScaLP::Constraint::type::C3) return false;
+  if(constraints[i].linear.size()!=1) return false;
+
+  // rows with the bound on the left side are stored negated (-term rel -bound)
+  const double rhs = c.ctype==ScaLP::Constraint::type::C2R
+    ? c.ubound-c.term.constant
+    : c.term.constant-c.lbound;
+  try
+  {
+    constraints[i].linear.front().set(GRB_DoubleAttr_RHS,rhs);
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return true;
+}
+
+bool ScaLP::SolverGurobi::removeConstraints(std::size_t n)
+{
+  if(n>constraints.size()) return false;
+
+  try
+  {
+    for(std::size_t i=0;i<n;++i)
+    {
+      BackendConstraint& c = constraints.back();
+      for(auto& l:c.linear) model.remove(l);
+    #if GRB_VERSION_MAJOR >= 7
+      for(auto& g:c.general) model.remove(g);
+    #endif
+      constraints.pop_back();
+    }
+    model.update();
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return true;
+}
+
+bool ScaLP::SolverGurobi::updateObjective(ScaLP::Objective o)
+{
+  // GRBModel::setObjective replaces the whole objective
+  return setObjective(o);
+}
+
+// the relative gap as defined by gurobi
+static ScaLP::Progress progress(double runtime, double best, double bound, double nodes, double offset)
+{
+  ScaLP::Progress p;
+  p.time = runtime;
+  p.nodes = static_cast<long long>(nodes);
+  if(std::abs(bound)<GRB_INFINITY) p.dualBound = bound+offset;
+  if(std::abs(best)<GRB_INFINITY)
+  {
+    p.primalBound = best+offset;
+    p.gap = best==0 ? (bound==0 ? 0 : GRB_INFINITY) : std::abs(best-bound)/std::abs(best);
+  }
+  return p;
+}
+
+void ScaLP::SolverGurobi::Callback::callback()
+{
+  try
+  {
+    if(where==GRB_CB_MIPSOL and solver->firstIncumbentTime<0)
+    {
+      solver->firstIncumbentTime = getDoubleInfo(GRB_CB_RUNTIME);
+    }
+
+    ScaLP::Result res;
+    if(where==GRB_CB_MIPSOL and (solver->incumbentCallback or solver->progressCallback))
+    {
+      res.objectiveValue = getDoubleInfo(GRB_CB_MIPSOL_OBJ)+solver->objectiveOffset;
+      for(auto &p:solver->variables)
+      {
+        res.values.emplace(p.first,getSolution(p.second));
+      }
+    }
+    if(where==GRB_CB_MIPSOL and solver->incumbentCallback and not solver->stopped)
+    {
+      solver->incumbentCallback(res);
+    }
+
+    if(solver->progressCallback and not solver->stopped)
+    {
+      bool report=true;
+      ScaLP::Progress p;
+      if(where==GRB_CB_MIPSOL)
+      {
+        p = progress(getDoubleInfo(GRB_CB_RUNTIME),getDoubleInfo(GRB_CB_MIPSOL_OBJBST)
+            ,getDoubleInfo(GRB_CB_MIPSOL_OBJBND),getDoubleInfo(GRB_CB_MIPSOL_NODCNT),solver->objectiveOffset);
+        // OBJBST may not contain the new solution yet
+        p.primalBound = res.objectiveValue;
+        p.incumbent = &res;
+      }
+      else if(where==GRB_CB_MIP)
+      {
+        p = progress(getDoubleInfo(GRB_CB_RUNTIME),getDoubleInfo(GRB_CB_MIP_OBJBST)
+            ,getDoubleInfo(GRB_CB_MIP_OBJBND),getDoubleInfo(GRB_CB_MIP_NODCNT),solver->objectiveOffset);
+      }
+      else report=false;
+
+      if(report and not solver->progressCallback(p)) solver->stopped=true;
+    }
+
+  }
+  // exceptions must not pass through Gurobi, solve() throws them again
+  catch(GRBException &e)
+  {
+    if(not solver->callbackError)
+    {
+      solver->callbackError=std::make_exception_ptr(ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage()));
+    }
+    solver->stopped=true;
+  }
+  catch(...)
+  {
+    if(not solver->callbackError) solver->callbackError=std::current_exception();
+    solver->stopped=true;
+  }
+
+  if(solver->interrupted or solver->stopped) abort();
+}
+
+bool ScaLP::SolverGurobi::setProgressCallback(ScaLP::ProgressCallback f)
+{
+  // reported by the callback
+  progressCallback=f;
+  return true;
+}
+
+bool ScaLP::SolverGurobi::interrupt()
+{
+  // the callback aborts the optimization in the solving thread
+  interrupted=true;
+  return true;
+}
+
+void ScaLP::SolverGurobi::clearInterrupt()
+{
+  interrupted=false;
+}
+
+bool ScaLP::SolverGurobi::setSolutionPool(std::size_t n)
+{
+  try
+  {
+    if(n==0)
+    { // the defaults of Gurobi
+      model.getEnv().set(GRB_IntParam_PoolSearchMode,0);
+      model.getEnv().set(GRB_IntParam_PoolSolutions,10);
+    }
+    else
+    { // search systematically for the n best solutions
+      model.getEnv().set(GRB_IntParam_PoolSearchMode,2);
+      model.getEnv().set(GRB_IntParam_PoolSolutions,static_cast<int>(std::min<std::size_t>(n,2000000000)));
+    }
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return true;
+}
+
+std::vector<ScaLP::Result> ScaLP::SolverGurobi::getSolutions()
+{
+  std::vector<ScaLP::Result> rs;
+  try
+  {
+    const int n = model.get(GRB_IntAttr_SolCount);
+    for(int i=0;i<n;++i)
+    {
+      model.getEnv().set(GRB_IntParam_SolutionNumber,i);
+      ScaLP::Result res;
+      res.objectiveValue = model.get(GRB_DoubleAttr_PoolObjVal)+objectiveOffset;
+      for(auto &p:variables)
+      {
+        res.values.emplace(p.first,p.second.get(GRB_DoubleAttr_Xn));
+      }
+      rs.push_back(std::move(res));
+    }
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return rs;
+}
+
+bool ScaLP::SolverGurobi::setRelaxation(bool r)
+{
+  relaxation=r;
+  try
+  {
+    for(auto &p:variables)
+    {
+      p.second.set(GRB_CharAttr_VType,variableType(typeOf(p.first)));
+    }
+  }catch(GRBException &e)
+  {
+    throw ScaLP::Exception(std::to_string(e.getErrorCode())+" "+e.getMessage());
+  }
+  return true;
+}
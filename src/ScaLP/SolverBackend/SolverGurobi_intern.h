@@ -4,8 +4,11 @@
 
 #include "gurobi_c++.h"
 
+#include <atomic>
+#include <exception>
 #include <string>
 #include <map>
+#include <vector>
 
 namespace ScaLP
 {
@@ -23,22 +26,60 @@ namespace ScaLP
       virtual void reset() override;
       virtual void setConsoleOutput(bool verbose) override;
       virtual void setTimeout(long timeout) override;
+      virtual void setTimeLimit(double seconds) override;
       virtual void setIntFeasTol(double intFeasTol) override;
       virtual void presolve(bool presolve) override;
       virtual void setThreads(unsigned int t) override;
       virtual void setRelativeMIPGap(double d) override;
       virtual void setAbsoluteMIPGap(double d) override;
       virtual void setStartValues(const ScaLP::Result& start) override;
+      virtual bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub) override;
+      virtual bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c) override;
+      virtual bool removeConstraints(std::size_t n) override;
+      virtual bool updateObjective(ScaLP::Objective o) override;
+      virtual bool interrupt() override;
+      virtual void clearInterrupt() override;
+      virtual bool setProgressCallback(ScaLP::ProgressCallback f) override;
+      virtual bool setSolutionPool(std::size_t n) override;
+      virtual std::vector<ScaLP::Result> getSolutions() override;
+      virtual bool setRelaxation(bool r) override;
 
     private:
       // map some values
       char variableType(ScaLP::VariableType t);
       GRBLinExpr mapTerm(ScaLP::Term t);
+      ScaLP::SolveStatistics statistics(int grbStatus, const ScaLP::Result& res);
       double mapValue(double d);
 
       GRBEnv environment;
       GRBModel model;
 
       std::map<ScaLP::Variable,GRBVar> variables;
+
+      // the Gurobi-constraints of each added constraint (in order)
+      struct BackendConstraint
+      {
+        std::vector<GRBConstr> linear;
+      #if GRB_VERSION_MAJOR >= 7
+        std::vector<GRBGenConstr> general;
+      #endif
+      };
+      std::vector<BackendConstraint> constraints;
+
+      // reports incumbents and checks for interruptions
+      class Callback : public GRBCallback
+      {
+        public:
+          Callback(SolverGurobi* s):solver(s){}
+        protected:
+          void callback() override;
+        private:
+          SolverGurobi* solver;
+      };
+      Callback callback{this};
+      std::atomic<bool> interrupted{false};
+      double firstIncumbentTime=-1; // runtime at the first solution of the solve
+      bool stopped=false;           // the progress callback stopped the solve
+      std::exception_ptr callbackError; // thrown by a callback while solving
   };
 }
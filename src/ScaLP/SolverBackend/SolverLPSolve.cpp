@@ -2,6 +2,10 @@
 #include <ScaLP/SolverBackend/SolverLPSolve_intern.h>
 #include <ScaLP/SolverBackend/SolverLPSolve.h>
 
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <ScaLP/Exception.h>
@@ -21,7 +25,7 @@ ScaLP::SolverBackend* ScaLP::newSolverLPSolve()
 ScaLP::SolverLPSolve::SolverLPSolve()
   :lp(make_lp(0,0))
 {
-  set_infinite(lp,ScaLP::INF());
+  initialize();
   name="LPSolve";
   this->features.lp=true;
   this->features.ilp=true;
@@ -29,6 +33,8 @@ ScaLP::SolverLPSolve::SolverLPSolve()
   this->features.milp=true;
   this->features.indicators=false;
   this->features.logical=false;
+  this->features.incremental=true;
+  this->features.warmstart=true;
 }
 
 ScaLP::SolverLPSolve::~SolverLPSolve()
@@ -36,15 +42,109 @@ ScaLP::SolverLPSolve::~SolverLPSolve()
   delete_lp(lp);
 }
 
+// settings of a new lprec
+void ScaLP::SolverLPSolve::initialize()
+{
+  set_infinite(lp,ScaLP::INF());
+  put_abortfunc(lp,abortCallback,this);
+  put_msgfunc(lp,messageCallback,this,MSG_MILPFEASIBLE|MSG_MILPBETTER);
+}
+
+// seconds between two progress reports of the abort-function
+static const double progressInterval = 0.1;
+
+int __WINAPI ScaLP::SolverLPSolve::abortCallback(lprec* lp, void* handle)
+{
+  auto* s = static_cast<ScaLP::SolverLPSolve*>(handle);
+
+  // called very often while solving, the progress is reported in intervals
+  // (exceptions must not pass through lp_solve, solve() throws them again)
+  if(s->progressCallback and not s->stopped and time_elapsed(lp)-s->lastProgress>=progressInterval)
+  {
+    s->lastProgress=time_elapsed(lp);
+    try
+    {
+      if(not s->progressCallback(s->progress(nullptr))) s->stopped=true;
+    }
+    catch(...)
+    {
+      if(not s->callbackError) s->callbackError=std::current_exception();
+      s->stopped=true;
+    }
+  }
+  return (s->interrupted or s->stopped) ? TRUE : FALSE;
+}
+
+void __WINAPI ScaLP::SolverLPSolve::messageCallback(lprec* lp, void* handle, int msg)
+{
+  (void)(msg);
+  auto* s = static_cast<ScaLP::SolverLPSolve*>(handle);
+  if(not s->improved) s->firstIncumbentTime=time_elapsed(lp);
+  s->improved=true;
+  ++s->solutions;
+
+  if(not s->incumbentCallback and not s->progressCallback) return;
+  if(s->stopped) return;
+  try
+  {
+    const ScaLP::Result res = s->extractResult();
+    if(s->incumbentCallback) s->incumbentCallback(res);
+    if(s->progressCallback)
+    {
+      s->lastProgress=time_elapsed(lp);
+      if(not s->progressCallback(s->progress(&res))) s->stopped=true;
+    }
+  }
+  catch(...)
+  {
+    // the abort-function ends the solve
+    if(not s->callbackError) s->callbackError=std::current_exception();
+    s->stopped=true;
+  }
+}
+
+// lp_solve does not report a dual bound while solving
+ScaLP::Progress ScaLP::SolverLPSolve::progress(const ScaLP::Result* incumbent)
+{
+  ScaLP::Progress p;
+  p.time = time_elapsed(lp);
+  if(improved) p.primalBound = get_working_objective(lp)+objectiveOffset;
+  p.nodes = get_total_nodes(lp);
+  p.incumbent = incumbent;
+  return p;
+}
+
+bool ScaLP::SolverLPSolve::setProgressCallback(ScaLP::ProgressCallback f)
+{
+  // reported by the abort- and message-function
+  progressCallback=f;
+  return true;
+}
+
+ScaLP::Result ScaLP::SolverLPSolve::extractResult()
+{
+  ScaLP::Result res;
+  res.objectiveValue=get_objective(lp)+objectiveOffset;
+
+  double* vals;
+  get_ptr_variables(lp,&vals);
+  for(auto&p:variables)
+  {
+    res.values.emplace(p.first,vals[p.second-1]);
+  }
+  return res;
+}
+
 bool ScaLP::SolverLPSolve::addVariable(const ScaLP::Variable& v)
 {
 #undef REAL
+  rowMode(false);
   bool success=true;
   ++variableCounter;
   success = success && variables.emplace(v,variableCounter).second;
   success = success && set_col_name(lp,variableCounter,const_cast<char*>(v->getName().c_str()));
   success = success && set_bounds(lp,variableCounter,v->getLowerBound(),v->getUpperBound());
-  switch (v->getType())
+  switch (typeOf(v))
   {
     case ScaLP::VariableType::INTEGER:
       success = success && set_int(lp,variableCounter,true);
@@ -61,6 +161,18 @@ bool ScaLP::SolverLPSolve::addVariable(const ScaLP::Variable& v)
   return success;
 }
 
+bool ScaLP::SolverLPSolve::addVariables(const ScaLP::VariableSet& vs)
+{
+  // reserve the columns once
+  resize_lp(lp,get_Nrows(lp),get_Ncolumns(lp)+vs.size());
+  bool success=true;
+  for(const ScaLP::Variable& v:vs)
+  {
+    success = success && addVariable(v);
+  }
+  return success;
+}
+
 static char mapRelation(ScaLP::relation r)
 {
   switch(r)
@@ -92,53 +204,103 @@ static ScaLP::relation invertRelation(ScaLP::relation r)
   }
 }
 
-bool ScaLP::SolverLPSolve::addConstrH(const ScaLP::Term& t, int rel, double rhs, std::string name)
+// the lower and upper bound of a range (lbound >= term >= ubound is flipped)
+static std::pair<double,double> rangeBounds(const ScaLP::Constraint& c)
+{
+  if(c.lrel==ScaLP::relation::MORE_EQ_THAN) return {c.ubound,c.lbound};
+  return {c.lbound,c.ubound};
+}
+
+// the matrix is built row by row until the first other change of the model
+// (lp_solve allows row mode only before the first solve)
+void ScaLP::SolverLPSolve::rowMode(bool on)
+{
+  if(on!=static_cast<bool>(is_add_rowmode(lp))) set_add_rowmode(lp,on);
+}
+
+bool ScaLP::SolverLPSolve::addConstrH(const ScaLP::Term& t, int rel, double rhs)
 {
   std::vector<double> coeffs;
   std::vector<int> indices;
   coeffs.reserve(t.sum.size());
   indices.reserve(t.sum.size());
 
-  set_add_rowmode(lp, true);
-
   for(auto&p:t.sum)
   {
     coeffs.push_back(p.second);
     indices.push_back(variables.at(p.first));
   }
 
-  add_constraintex(lp,coeffs.size(),coeffs.data(),indices.data(),rel,rhs+t.constant);
-
-  set_add_rowmode(lp, false);
+  return add_constraintex(lp,coeffs.size(),coeffs.data(),indices.data(),rel,rhs+t.constant);
+}
 
-  return true;
+// lb <= row <= ub, the right hand side of a LE-row is ub, otherwise lb
+bool ScaLP::SolverLPSolve::setRange(int row, double lb, double ub)
+{
+  const int type = get_constr_type(lp,row);
+  bool success = set_rh(lp,row,(type==LE)?ub:lb);
+  return success and set_rh_range(lp,row,ub-lb);
 }
 
 bool ScaLP::SolverLPSolve::addConstraint(const ScaLP::Constraint& cons)
 {
+  rowMode(true);
+
+  bool success=false;
   switch(cons.ctype)
   {
     case ScaLP::Constraint::type::C2L:
-      addConstrH(cons.term,mapRelation(invertRelation(cons.lrel)),cons.lbound,cons.name);
+      success=addConstrH(cons.term,mapRelation(invertRelation(cons.lrel)),cons.lbound);
       break;
     case ScaLP::Constraint::type::C2R:
-      addConstrH(cons.term,mapRelation(cons.rrel),cons.ubound,cons.name);
+      success=addConstrH(cons.term,mapRelation(cons.rrel),cons.ubound);
       break;
     case ScaLP::Constraint::type::CEQ:
-      addConstrH(cons.term,mapRelation(cons.lrel),cons.lbound,cons.name);
+      success=addConstrH(cons.term,mapRelation(cons.lrel),cons.lbound);
       break;
     case ScaLP::Constraint::type::C3:
-      // TODO: better way than two Constraints?
-      addConstrH(cons.term,mapRelation(invertRelation(cons.lrel)),cons.lbound,cons.name);
-      addConstrH(cons.term,mapRelation(cons.rrel),cons.ubound,cons.name);
+    {
+      // a single row with a range
+      double lb,ub;
+      std::tie(lb,ub) = rangeBounds(cons);
+      if(lb>ub)
+      {
+        // lp_solve has no empty ranges, the row is kept for the indices
+        success=addConstrH(cons.term,LE,ub);
+        if(success) emptyRanges.insert(get_Nrows(lp));
+      }
+      else if(lb==ub) success=addConstrH(cons.term,EQ,lb);
+      else if(ub<ScaLP::INF())
+      {
+        success=addConstrH(cons.term,LE,ub);
+        if(success and lb>-ScaLP::INF()) success=set_rh_range(lp,get_Nrows(lp),ub-lb);
+      }
+      else success=addConstrH(cons.term,GE,lb);
       break;
+    }
   }
 
+  if(success) ++constraintCounter;
+  return success;
+}
+
+bool ScaLP::SolverLPSolve::addConstraints(const std::vector<ScaLP::Constraint>& cons)
+{
+  // reserve the rows once
+  resize_lp(lp,get_Nrows(lp)+cons.size(),get_Ncolumns(lp));
+  for(const ScaLP::Constraint &c:cons)
+  {
+    if(not addConstraint(c))
+    {
+      throw ScaLP::Exception("Scalp: Can't add Constraint \"" + c.name + "\" to the backend.");
+    }
+  }
   return true;
 }
 
 bool ScaLP::SolverLPSolve::setObjective(ScaLP::Objective o)
 {
+  rowMode(false);
   set_sense(lp,o.getType()==ScaLP::Objective::type::MAXIMIZE);
 
   std::vector<double> coeffs;
@@ -166,6 +328,28 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverLPSolve::solve()
 #undef TIMEOUT
   ScaLP::status stat= ScaLP::status::ERROR;
   ScaLP::Result res;
+  improved=false;
+  solutions=0;
+  firstIncumbentTime=-1;
+  stopped=false;
+  callbackError=nullptr;
+  lastProgress=0;
+  rowMode(false);
+
+  // a range without values
+  if(not emptyRanges.empty())
+  {
+    startValues.clear();
+    return {ScaLP::status::INFEASIBLE,res};
+  }
+
+  if(duals) set_presolve(lp,get_presolve(lp)|PRESOLVE_SENSDUALS,get_presolveloops(lp));
+
+  // a feasible start of a MIP is the incumbent
+  ScaLP::Result start;
+  warmStart(start);
+  bool fromStart=false;
+
   int resType = ::solve(lp);
   // codes, see: http://lpsolve.sourceforge.net/5.5/solve.htm
   switch(resType)
@@ -174,21 +358,69 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverLPSolve::solve()
     case 1: stat = ScaLP::status::FEASIBLE;   break;
     case 2: stat = ScaLP::status::INFEASIBLE; break;
     case 3: stat = ScaLP::status::UNBOUND;    break;
+    case 6:
+      stat = improved ? ScaLP::status::CANCELLED_FEASIBLE : ScaLP::status::CANCELLED_INFEASIBLE;
+      break;
     case 7: stat = ScaLP::status::TIMEOUT_INFEASIBLE; break;
             // FIXME: detecting TIMEOUT_FEASIBLE not possible without measuring
             // time. 
   }
 
-  if(stat==ScaLP::status::OPTIMAL or stat==ScaLP::status::FEASIBLE)
+  if(stat==ScaLP::status::OPTIMAL or stat==ScaLP::status::FEASIBLE or stat==ScaLP::status::CANCELLED_FEASIBLE)
   {
-    res.objectiveValue=get_objective(lp)+objectiveOffset;
-
-    double* vals;
-    get_ptr_variables(lp,&vals);
-    for(auto&p:variables)
+    res=extractResult();
+  }
+  else if(not start.values.empty() and not improved)
+  {
+    // nothing better than the start was found (lp_solve prunes up to its objective)
+    fromStart=true;
+    switch(stat)
     {
-      res.values.emplace(p.first,vals[p.second-1]);
+      case ScaLP::status::INFEASIBLE:           stat = ScaLP::status::OPTIMAL;            break;
+      case ScaLP::status::TIMEOUT_INFEASIBLE:   stat = ScaLP::status::TIMEOUT_FEASIBLE;   break;
+      case ScaLP::status::CANCELLED_INFEASIBLE: stat = ScaLP::status::CANCELLED_FEASIBLE; break;
+      default: fromStart=false; break;
     }
+    if(fromStart)
+    {
+      res.objectiveValue=start.objectiveValue;
+      res.values=start.values;
+      ++solutions;
+    }
+  }
+  if(not start.values.empty())
+  {
+    set_obj_bound(lp,is_maxim(lp)?-get_infinite(lp):get_infinite(lp));
+  }
+  if(callbackError) std::rethrow_exception(callbackError);
+
+  // keep the basis for a rebuilt model
+  if(stat!=ScaLP::status::ERROR)
+  {
+    basisRows=get_Nrows(lp);
+    basisColumns=get_Ncolumns(lp);
+    basis.assign(1+basisRows+basisColumns,0);
+    if(not get_basis(lp,basis.data(),TRUE)) basis.clear();
+  }
+  fresh=false;
+
+  // lp_solve reports no bound for unfinished solves
+  res.statistics.iterations = get_total_iter(lp);
+  res.statistics.nodes = get_total_nodes(lp);
+  res.statistics.firstIncumbentTime = firstIncumbentTime;
+  if(res.values.empty()) res.statistics.solutions = solutions;
+  else res.statistics.solutions = std::max(solutions,1LL); // LPs do not report incumbents
+  if(stat==ScaLP::status::OPTIMAL)
+  {
+    res.statistics.dualBound = res.objectiveValue;
+    res.statistics.gap = 0;
+  }
+
+  // the duals of the rows (followed by the reduced costs of the columns)
+  double* rowDuals=nullptr;
+  if(duals and stat==ScaLP::status::OPTIMAL and not fromStart and get_ptr_sensitivity_rhs(lp,&rowDuals,nullptr,nullptr) and rowDuals!=nullptr)
+  {
+    res.duals.assign(rowDuals,rowDuals+constraintCounter);
   }
 
   return {stat,res};
@@ -199,10 +431,15 @@ void ScaLP::SolverLPSolve::reset()
   // clear the variables-cache
   variables.clear();
   variableCounter=0;
+  constraintCounter=0;
+  emptyRanges.clear();
   objectiveOffset=0;
+  startValues.clear();
+  fresh=true;
 
   delete_lp(lp);
   lp=make_lp(0,0);
+  initialize();
 }
 
 void ScaLP::SolverLPSolve::setConsoleOutput(bool verbose)
@@ -257,3 +494,204 @@ void ScaLP::SolverLPSolve::setAbsoluteMIPGap(double d)
 {
   set_mip_gap(lp,true,d);
 }
+
+void ScaLP::SolverLPSolve::setStartValues(const ScaLP::Result& start)
+{
+  rowMode(false);
+
+  // missing values are the bound nearest to zero
+  startValues.assign(1+get_Ncolumns(lp),0);
+  startComplete=true;
+  for(auto&p:variables)
+  {
+    auto it = start.values.find(p.first);
+    double& v = startValues[p.second];
+    if(it!=start.values.end()) v=it->second;
+    else
+    {
+      v=std::min(std::max(0.0,get_lowbo(lp,p.second)),get_upbo(lp,p.second));
+      startComplete=false;
+    }
+  }
+}
+
+// the objective value of the start values, false if they are not feasible
+bool ScaLP::SolverLPSolve::startObjective(double& objective)
+{
+  const int rows = get_Nrows(lp);
+  const int columns = get_Ncolumns(lp);
+  const double tol = 1e-6;
+  const double inf = get_infinite(lp);
+
+  for(int j=1;j<=columns;++j)
+  {
+    const double v = startValues[j];
+    if(v<get_lowbo(lp,j)-tol or v>get_upbo(lp,j)+tol) return false;
+    if(is_int(lp,j) and std::abs(v-std::round(v))>get_epsint(lp)) return false;
+  }
+
+  std::vector<double> values(1+columns);
+  std::vector<int> indices(1+columns);
+  for(int r=0;r<=rows;++r)
+  {
+    const int n = get_rowex(lp,r,values.data(),indices.data());
+    if(n<0) return false;
+    double activity=0;
+    for(int k=0;k<n;++k) activity+=values[k]*startValues[indices[k]];
+    if(r==0)
+    {
+      objective=activity;
+      continue;
+    }
+
+    // the bounds of the row: the right hand side and the range
+    const double rh = get_rh(lp,r);
+    const double range = get_rh_range(lp,r);
+    double lb=rh, ub=rh;
+    switch(get_constr_type(lp,r))
+    {
+      case LE: lb=(range>=inf)?-inf:rh-range; break;
+      case GE: ub=(range>=inf)?inf:rh+range; break;
+      default: break;
+    }
+    if(activity<lb-tol or activity>ub+tol) return false;
+  }
+  return true;
+}
+
+// start from the basis of the start values or of the last solve
+void ScaLP::SolverLPSolve::warmStart(ScaLP::Result& start)
+{
+  const int rows = get_Nrows(lp);
+  const int columns = get_Ncolumns(lp);
+
+  if(static_cast<int>(startValues.size())==1+columns)
+  {
+    std::vector<int> b(1+rows+columns,0);
+    if(guess_basis(lp,startValues.data(),b.data())) set_basis(lp,b.data(),TRUE);
+
+    // a complete and feasible start of a MIP bounds the branch and bound
+    bool mip=false;
+    for(int j=1;j<=columns and not mip;++j) mip=is_int(lp,j);
+    double objective;
+    if(mip and startComplete and startObjective(objective))
+    {
+      set_obj_bound(lp,objective);
+      start.objectiveValue=objective+objectiveOffset;
+      for(auto&p:variables) start.values.emplace(p.first,startValues[p.second]);
+    }
+  }
+  else if(fresh and not basis.empty() and basisRows==rows and basisColumns==columns)
+  {
+    // a rebuilt model of the same size
+    set_basis(lp,basis.data(),TRUE);
+  }
+  startValues.clear();
+}
+
+bool ScaLP::SolverLPSolve::setVariableBounds(const ScaLP::Variable& v, double lb, double ub)
+{
+  auto it = variables.find(v);
+  if(it==variables.end()) return false;
+  rowMode(false);
+  return set_bounds(lp,it->second,lb,ub);
+}
+
+bool ScaLP::SolverLPSolve::setConstraintBounds(std::size_t i, const ScaLP::Constraint& c)
+{
+  if(static_cast<int>(i)>=constraintCounter) return false;
+  rowMode(false);
+
+  // the row of the i-th constraint with the new right hand side
+  const int row = i+1;
+  const double k = c.term.constant;
+  switch(c.ctype)
+  {
+    case ScaLP::Constraint::type::C2L: return set_rh(lp,row,c.lbound+k);
+    case ScaLP::Constraint::type::C2R: return set_rh(lp,row,c.ubound+k);
+    case ScaLP::Constraint::type::CEQ: return set_rh(lp,row,c.lbound+k);
+    case ScaLP::Constraint::type::C3:
+    {
+      double lb,ub;
+      std::tie(lb,ub) = rangeBounds(c);
+      if(lb>ub)
+      {
+        emptyRanges.insert(row);
+        return true;
+      }
+
+      // the side the range is relative to has to stay finite (or it is rebuilt)
+      const int type = get_constr_type(lp,row);
+      if((type==LE and ub>=ScaLP::INF()) or (type!=LE and lb<=-ScaLP::INF())) return false;
+      emptyRanges.erase(row);
+      return setRange(row,lb+k,ub+k);
+    }
+  }
+  return false;
+}
+
+bool ScaLP::SolverLPSolve::removeConstraints(std::size_t n)
+{
+  if(static_cast<int>(n)>constraintCounter) return false;
+  rowMode(false);
+
+  // the constraints are the last rows of the model
+  for(std::size_t i=0;i<n;++i)
+  {
+    emptyRanges.erase(get_Nrows(lp));
+    if(not del_constraint(lp,get_Nrows(lp))) return false;
+    --constraintCounter;
+  }
+  return true;
+}
+
+bool ScaLP::SolverLPSolve::updateObjective(ScaLP::Objective o)
+{
+  // set_obj_fnex replaces the whole objective row
+  return setObjective(o);
+}
+
+bool ScaLP::SolverLPSolve::interrupt()
+{
+  interrupted=true;
+  return true;
+}
+
+void ScaLP::SolverLPSolve::clearInterrupt()
+{
+  interrupted=false;
+}
+
+bool ScaLP::SolverLPSolve::addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients)
+{
+  if(variables.find(v)!=variables.end() or not addVariable(v)) return false;
+  const int column = variableCounter;
+
+  bool success = set_mat(lp,0,column,obj);
+  for(auto& p:coefficients)
+  {
+    if(static_cast<int>(p.first)>=constraintCounter) return false;
+    success = success && set_mat(lp,p.first+1,column,p.second);
+  }
+  return success;
+}
+
+bool ScaLP::SolverLPSolve::setDualValues(bool d)
+{
+  // sensitivity analysis in solve()
+  duals=d;
+  return true;
+}
+
+bool ScaLP::SolverLPSolve::setRelaxation(bool r)
+{
+  relaxation=r;
+  rowMode(false);
+  // the bounds of binary variables are kept
+  bool success=true;
+  for(auto&p:variables)
+  {
+    success = success && set_int(lp,p.second,typeOf(p.first)!=ScaLP::VariableType::REAL);
+  }
+  return success;
+}
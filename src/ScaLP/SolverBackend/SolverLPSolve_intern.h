@@ -4,8 +4,12 @@
 
 #include <lpsolve/lp_lib.h>
 
+#include <atomic>
+#include <exception>
 #include <string>
 #include <map>
+#include <set>
+#include <vector>
 
 namespace ScaLP
 {
@@ -17,7 +21,9 @@ namespace ScaLP
 
       // basic functions
       virtual bool addVariable(const ScaLP::Variable& v) override;
+      virtual bool addVariables(const ScaLP::VariableSet& vs) override;
       virtual bool addConstraint(const ScaLP::Constraint& con) override;
+      virtual bool addConstraints(const std::vector<ScaLP::Constraint>& cons) override;
       virtual bool setObjective(ScaLP::Objective o) override;
       virtual std::pair<ScaLP::status,ScaLP::Result> solve() override;
       virtual void reset() override;
@@ -26,11 +32,52 @@ namespace ScaLP
       virtual void presolve(bool presolve) override;
       virtual void setRelativeMIPGap(double d) override;
       virtual void setAbsoluteMIPGap(double d) override;
+      virtual void setStartValues(const ScaLP::Result& start) override;
+      virtual bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub) override;
+      virtual bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c) override;
+      virtual bool removeConstraints(std::size_t n) override;
+      virtual bool updateObjective(ScaLP::Objective o) override;
+      virtual bool addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients) override;
+      virtual bool setDualValues(bool d) override;
+      virtual bool setRelaxation(bool r) override;
+      virtual bool interrupt() override;
+      virtual void clearInterrupt() override;
+      virtual bool setProgressCallback(ScaLP::ProgressCallback f) override;
 
     private:
       lprec* lp;
       std::map<ScaLP::Variable,int> variables;
       int variableCounter=0; // index of the last variable
-      bool addConstrH(const ScaLP::Term& t, int rel, double rhs, std::string name);
+      int constraintCounter=0;         // one row per constraint
+      std::set<int> emptyRanges;       // rows of ranges with lb>ub (the model is infeasible)
+      std::atomic<bool> interrupted{false};
+      bool improved=false;             // an incumbent was found in this solve
+      long long solutions=0;           // incumbents of this solve
+      double firstIncumbentTime=-1;    // time of the first incumbent
+      bool stopped=false;              // the progress callback stopped the solve
+      std::exception_ptr callbackError; // thrown by a callback while solving
+      double lastProgress=0;           // time of the last progress report
+      bool duals=false;                // compute the dual values
+
+      // warm start
+      std::vector<double> startValues; // values of the columns (index 0 is unused)
+      bool startComplete=false;        // all columns have a start value
+      std::vector<int> basis;          // the basis of the last solve (see get_basis)
+      int basisRows=0;
+      int basisColumns=0;
+      bool fresh=true;                 // the model was rebuilt since the last solve
+      void warmStart(ScaLP::Result& start);
+      bool startObjective(double& objective);
+
+      bool addConstrH(const ScaLP::Term& t, int rel, double rhs);
+      bool setRange(int row, double lb, double ub);
+      void rowMode(bool on);
+      void initialize();
+      ScaLP::Result extractResult();
+      ScaLP::Progress progress(const ScaLP::Result* incumbent);
+
+      // lp_solve callbacks (the user-handle is the backend)
+      static int __WINAPI abortCallback(lprec* lp, void* handle);
+      static void __WINAPI messageCallback(lprec* lp, void* handle, int msg);
   };
 }
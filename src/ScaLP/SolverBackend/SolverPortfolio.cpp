@@ -0,0 +1,397 @@
+
+#include <ScaLP/SolverBackend/SolverPortfolio.h>
+#include <ScaLP/SolverBackend.h>
+
+#include <ScaLP/Exception.h>
+#include <ScaLP/Result.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ScaLP
+{
+
+class SolverPortfolio : public SolverBackend
+{
+  public:
+  SolverPortfolio(std::vector<ScaLP::SolverBackend*> bs)
+  {
+    if(bs.empty())
+    {
+      throw ScaLP::Exception("ScaLP: Portfolio without backends");
+    }
+
+    name="Portfolio(";
+    features.lp=features.ilp=features.qp=features.milp=true;
+    features.indicators=features.logical=features.incremental=true;
+    for(auto b:bs)
+    {
+      members.emplace_back(b);
+      name+=(members.size()>1?",":"")+b->name;
+
+      // the model has to be valid for every backend
+      features.lp          = features.lp and b->features.lp;
+      features.ilp         = features.ilp and b->features.ilp;
+      features.qp          = features.qp and b->features.qp;
+      features.milp        = features.milp and b->features.milp;
+      features.indicators  = features.indicators and b->features.indicators;
+      features.logical     = features.logical and b->features.logical;
+      features.incremental = features.incremental and b->features.incremental;
+
+      // start values are passed to the backends which support them
+      features.warmstart   = features.warmstart or b->features.warmstart;
+    }
+    name+=")";
+  }
+
+  bool addVariable(const ScaLP::Variable& v) override
+  {
+    return all([&v](SolverBackend* b){return b->addVariable(v);});
+  }
+  bool addVariables(const ScaLP::VariableSet& vs) override
+  {
+    return parallel([&vs](SolverBackend* b){return b->addVariables(vs);});
+  }
+  bool addConstraint(const ScaLP::Constraint& con) override
+  {
+    return all([&con](SolverBackend* b){return b->addConstraint(con);});
+  }
+  bool addConstraints(const std::vector<ScaLP::Constraint>& cons) override
+  {
+    return parallel([&cons](SolverBackend* b){return b->addConstraints(cons);});
+  }
+  bool setObjective(ScaLP::Objective o) override
+  {
+    maximize = o.getType()==ScaLP::Objective::type::MAXIMIZE;
+    return parallel([&o](SolverBackend* b){return b->setObjective(o);});
+  }
+  std::pair<ScaLP::status,ScaLP::Result> solve() override;
+  void reset() override
+  {
+    parallel([](SolverBackend* b){b->reset(); return true;});
+    objectiveOffset=0;
+  }
+  void setConsoleOutput(bool verbose) override
+  {
+    all([verbose](SolverBackend* b){b->setConsoleOutput(verbose); return true;});
+  }
+  void setTimeout(long timeout) override
+  {
+    all([timeout](SolverBackend* b){b->setTimeout(timeout); return true;});
+  }
+  void setTimeLimit(double seconds) override
+  {
+    all([seconds](SolverBackend* b){b->setTimeLimit(seconds); return true;});
+  }
+  void setIntFeasTol(double intFeasTol) override
+  {
+    all([intFeasTol](SolverBackend* b){b->setIntFeasTol(intFeasTol); return true;});
+  }
+  void presolve(bool presolve) override
+  {
+    all([presolve](SolverBackend* b){b->presolve(presolve); return true;});
+  }
+  void setThreads(unsigned int t) override
+  {
+    all([t](SolverBackend* b){b->setThreads(t); return true;});
+  }
+  void setRelativeMIPGap(double d) override
+  {
+    all([d](SolverBackend* b){b->setRelativeMIPGap(d); return true;});
+  }
+  void setAbsoluteMIPGap(double d) override
+  {
+    all([d](SolverBackend* b){b->setAbsoluteMIPGap(d); return true;});
+  }
+  void setStartValues(const ScaLP::Result& start) override
+  {
+    all([&start](SolverBackend* b){
+      if(b->features.warmstart) b->setStartValues(start);
+      return true;
+    });
+  }
+  bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub) override
+  {
+    return all([&](SolverBackend* b){return b->setVariableBounds(v,lb,ub);});
+  }
+  bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c) override
+  {
+    return all([&](SolverBackend* b){return b->setConstraintBounds(i,c);});
+  }
+  bool removeConstraints(std::size_t n) override
+  {
+    return all([n](SolverBackend* b){return b->removeConstraints(n);});
+  }
+  bool updateObjective(ScaLP::Objective o) override
+  {
+    maximize = o.getType()==ScaLP::Objective::type::MAXIMIZE;
+    return all([&o](SolverBackend* b){return b->updateObjective(o);});
+  }
+  bool addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients) override
+  {
+    return all([&](SolverBackend* b){return b->addColumn(v,obj,coefficients);});
+  }
+  bool setDualValues(bool d) override
+  {
+    return all([d](SolverBackend* b){return b->setDualValues(d);});
+  }
+  bool interrupt() override
+  {
+    bool any=false;
+    for(auto& b:members) any = b->interrupt() or any;
+    return any;
+  }
+  void clearInterrupt() override
+  {
+    for(auto& b:members) b->clearInterrupt();
+  }
+  bool setObjectiveCutoff(double d) override
+  {
+    bool any=false;
+    for(auto& b:members) any = b->setObjectiveCutoff(d) or any;
+    return any;
+  }
+  bool setRelaxation(bool r) override
+  {
+    return all([r](SolverBackend* b){return b->setRelaxation(r);});
+  }
+  bool setSolutionPool(std::size_t n) override
+  {
+    bool any=false;
+    for(auto& b:members) any = b->setSolutionPool(n) or any;
+    return any;
+  }
+  std::vector<ScaLP::Result> getSolutions() override
+  {
+    // the interrupted members found feasible solutions too
+    std::vector<ScaLP::Result> rs;
+    for(auto& b:members)
+    {
+      std::vector<ScaLP::Result> s = b->getSolutions();
+      rs.insert(rs.end(),s.begin(),s.end());
+    }
+    std::stable_sort(rs.begin(),rs.end(),[this](const ScaLP::Result& a, const ScaLP::Result& b)
+    {
+      return better(a.objectiveValue,b.objectiveValue);
+    });
+    return rs;
+  }
+  bool setProgressCallback(ScaLP::ProgressCallback f) override
+  {
+    progressCallback=f;
+    bool any=false;
+    for(auto& b:members)
+    {
+      if(not f)
+      {
+        b->setProgressCallback(nullptr);
+        continue;
+      }
+
+      // the members report concurrently, stopping one stops all
+      // (an exception is thrown by the solve of the member)
+      any = b->setProgressCallback([this](const ScaLP::Progress& p)
+      {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        bool next=false;
+        try
+        {
+          next = progressCallback(p);
+        }
+        catch(...)
+        {
+          progressStopped=true;
+          for(auto& m:members) m->interrupt();
+          throw;
+        }
+        if(next) return true;
+        progressStopped=true;
+        for(auto& m:members) m->interrupt();
+        return false;
+      }) or any;
+    }
+    return any;
+  }
+
+  private:
+  std::vector<std::unique_ptr<SolverBackend>> members;
+  bool maximize=false;
+  std::mutex progressMutex;
+  std::atomic<bool> progressStopped{false}; // the members were interrupted by the callback
+
+  // call f for every backend, true if all calls succeeded
+  template<class F>
+  bool all(const F& f)
+  {
+    bool success=true;
+    for(auto& b:members) success = f(b.get()) and success;
+    return success;
+  }
+
+  // like all, but every backend in its own thread
+  template<class F>
+  bool parallel(const F& f)
+  {
+    if(members.size()==1) return f(members[0].get());
+
+    std::vector<std::thread> ts;
+    std::vector<char> success(members.size(),false);
+    std::vector<std::exception_ptr> errors(members.size());
+    for(std::size_t i=0;i<members.size();++i)
+    {
+      ts.emplace_back([&,i]()
+      {
+        try
+        {
+          success[i] = f(members[i].get());
+        }
+        catch(...)
+        {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    for(auto& t:ts) t.join();
+
+    for(auto& e:errors)
+    {
+      if(e) std::rethrow_exception(e);
+    }
+    for(auto s:success)
+    {
+      if(not s) return false;
+    }
+    return true;
+  }
+
+  bool better(double a, double b) const
+  {
+    return maximize ? a>b : a<b;
+  }
+};
+
+} // namespace ScaLP
+
+// results which end the race
+static bool definitive(ScaLP::status s)
+{
+  return s==ScaLP::status::OPTIMAL
+      or s==ScaLP::status::INFEASIBLE
+      or s==ScaLP::status::UNBOUND
+      or s==ScaLP::status::INFEASIBLE_OR_UNBOUND;
+}
+
+static bool feasible(ScaLP::status s)
+{
+  return s==ScaLP::status::FEASIBLE
+      or s==ScaLP::status::TIMEOUT_FEASIBLE
+      or s==ScaLP::status::CANCELLED_FEASIBLE;
+}
+
+std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverPortfolio::solve()
+{
+  const std::size_t n=members.size();
+  std::vector<std::pair<ScaLP::status,ScaLP::Result>> results(n,{ScaLP::status::ERROR,ScaLP::Result()});
+  std::vector<char> cutoff(n,false); // a cutoff was passed to the backend
+  std::mutex mutex;
+  int winner=-1;
+  bool haveIncumbent=false;
+  ScaLP::Result incumbent;
+
+  // share new incumbents
+  for(std::size_t i=0;i<n;++i)
+  {
+    members[i]->setIncumbentCallback([&,i](const ScaLP::Result& r)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(haveIncumbent and not better(r.objectiveValue,incumbent.objectiveValue)) return;
+      haveIncumbent=true;
+      incumbent=r;
+      for(std::size_t j=0;j<n;++j)
+      {
+        if(j!=i and members[j]->setObjectiveCutoff(r.objectiveValue)) cutoff[j]=true;
+      }
+      if(incumbentCallback) incumbentCallback(r);
+    });
+  }
+
+  std::vector<std::thread> ts;
+  std::vector<std::exception_ptr> errors(n);
+  for(std::size_t i=0;i<n;++i)
+  {
+    ts.emplace_back([&,i]()
+    {
+      std::pair<ScaLP::status,ScaLP::Result> r;
+      try
+      {
+        r = members[i]->solve();
+      }
+      catch(...)
+      {
+        errors[i] = std::current_exception();
+        r.first = ScaLP::status::ERROR;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      results[i]=r;
+      if(winner<0 and definitive(r.first))
+      {
+        winner=static_cast<int>(i);
+        for(std::size_t j=0;j<n;++j)
+        {
+          if(j!=i) members[j]->interrupt();
+        }
+      }
+    });
+  }
+  for(auto& t:ts) t.join();
+
+  for(auto& b:members)
+  {
+    b->setIncumbentCallback(nullptr);
+  }
+
+  // the interruptions of the race (and of the callback) end with this solve
+  const bool stopped = progressStopped.exchange(false);
+  for(auto& b:members) b->clearInterrupt();
+
+  if(winner>=0)
+  {
+    // nothing better than the shared incumbent exists
+    if(results[winner].first==ScaLP::status::INFEASIBLE and cutoff[winner] and haveIncumbent)
+    {
+      return {ScaLP::status::OPTIMAL,incumbent};
+    }
+    return results[winner];
+  }
+
+  // no backend finished, return the best solution
+  int best=-1;
+  for(std::size_t i=0;i<n;++i)
+  {
+    if(feasible(results[i].first)
+      and (best<0 or better(results[i].second.objectiveValue,results[best].second.objectiveValue)))
+    {
+      best=static_cast<int>(i);
+    }
+  }
+  // the callback stopped the solve, not a timeout of a member
+  if(best>=0 and stopped) return {ScaLP::status::CANCELLED_FEASIBLE,results[best].second};
+  if(best>=0) return results[best];
+
+  for(auto& e:errors)
+  {
+    if(e) std::rethrow_exception(e);
+  }
+  if(stopped) return {ScaLP::status::CANCELLED_INFEASIBLE,ScaLP::Result()};
+  return results[0];
+}
+
+ScaLP::SolverBackend* ScaLP::newSolverPortfolio(std::vector<ScaLP::SolverBackend*> backends)
+{
+  return new SolverPortfolio(backends);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <ScaLP/SolverBackend.h>
+
+#include <vector>
+
+namespace ScaLP
+{
+  // create a SolverBackend which races the given backends.
+  // The model is constructed in all backends (in parallel) and every solve
+  // runs all of them in their own thread. The first definitive result
+  // (optimal, infeasible or unbounded) is returned and the other backends are
+  // interrupted. New incumbents are passed to the other backends as an
+  // objective cutoff (if they support it).
+  // The memory of the backends is managed by the portfolio.
+  //
+  // It is also available through the dynamic backend:
+  //   ScaLP::Solver s{"Portfolio:SCIP,LPSolve"};
+  ScaLP::SolverBackend* newSolverPortfolio(std::vector<ScaLP::SolverBackend*> backends);
+}
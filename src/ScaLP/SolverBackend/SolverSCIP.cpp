@@ -4,10 +4,13 @@
 
 #include <ScaLP/Exception.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <utility>
 #include <iostream>
 #include <string>
+#include <initializer_list>
 
 namespace ScaLP
 {
@@ -42,6 +45,8 @@ ScaLP::SolverSCIP::SolverSCIP()
   this->features.milp=true;
   this->features.indicators=false;
   this->features.logical=false;
+  this->features.warmstart=true;
+  this->features.incremental=true;
 }
 
 ScaLP::SolverSCIP::~SolverSCIP()
@@ -74,19 +79,186 @@ static SCIP_VARTYPE mapVariableType(ScaLP::VariableType t)
   }
 }
 
+// the event handler reports incumbents and checks for interruptions
+static SCIP_DECL_EVENTEXEC(eventExecScaLP)
+{
+  (void)(scip);
+  (void)(eventdata);
+  auto* s = reinterpret_cast<ScaLP::SolverSCIP*>(SCIPeventhdlrGetData(eventhdlr));
+  return s->processEvent(event);
+}
+
+static const SCIP_EVENTTYPE eventsScaLP = SCIP_EVENTTYPE_BESTSOLFOUND
+                                        | SCIP_EVENTTYPE_NODESOLVED
+                                        | SCIP_EVENTTYPE_PRESOLVEROUND
+                                        | SCIP_EVENTTYPE_LPSOLVED;
+
+static SCIP_DECL_EVENTINIT(eventInitScaLP)
+{
+  return SCIPcatchEvent(scip,eventsScaLP,eventhdlr,nullptr,nullptr);
+}
+
+static SCIP_DECL_EVENTEXIT(eventExitScaLP)
+{
+  return SCIPdropEvent(scip,eventsScaLP,eventhdlr,nullptr,-1);
+}
+
+ScaLP::Result ScaLP::SolverSCIP::solution(SCIP_SOL* sol)
+{
+  ScaLP::Result res;
+  res.objectiveValue = SCIPgetSolOrigObj(scip,sol) + objectiveOffset;
+  for(auto &p:variables)
+  {
+    res.values.emplace(p.first,SCIPgetSolVal(scip,sol,p.second));
+  }
+  return res;
+}
+
+SCIP_RETCODE ScaLP::SolverSCIP::processEvent(SCIP_EVENT* event)
+{
+  // the LPs of the root and of long nodes only check for interruptions
+  if(SCIPeventGetType(event) & SCIP_EVENTTYPE_LPSOLVED)
+  {
+    if(interrupted or stopped) return SCIPinterruptSolve(scip);
+    return SCIP_OKAY;
+  }
+
+  const bool improved = SCIPeventGetType(event) & SCIP_EVENTTYPE_BESTSOLFOUND;
+  if(improved and firstIncumbentTime<0)
+  {
+    firstIncumbentTime = SCIPgetSolvingTime(scip);
+  }
+
+  // exceptions must not pass through SCIP, solve() throws them again
+  try
+  {
+    ScaLP::Result res;
+    if(improved and (incumbentCallback or progressCallback))
+    {
+      res = solution(SCIPeventGetSol(event));
+    }
+    if(improved and incumbentCallback and not stopped) incumbentCallback(res);
+
+    if(progressCallback and not stopped)
+    {
+      ScaLP::Progress p;
+      p.time = SCIPgetSolvingTime(scip);
+      if(SCIPgetNSols(scip)>0)
+      {
+        p.primalBound = SCIPgetPrimalbound(scip) + objectiveOffset;
+        p.gap = SCIPgetGap(scip);
+      }
+      p.dualBound = SCIPgetDualbound(scip) + objectiveOffset;
+      p.nodes = SCIPgetNNodes(scip);
+      if(improved) p.incumbent = &res;
+      if(not progressCallback(p)) stopped=true;
+    }
+  }
+  catch(...)
+  {
+    if(not callbackError) callbackError=std::current_exception();
+    stopped=true;
+  }
+
+  if(cutoffPending.exchange(false))
+  {
+    // SCIP only accepts tighter limits while solving
+    double limit = cutoff - objectiveOffset;
+    bool maximize = SCIPgetObjsense(scip)==SCIP_OBJSENSE_MAXIMIZE;
+    if(maximize ? limit>SCIPgetObjlimit(scip) : limit<SCIPgetObjlimit(scip))
+    {
+      SCIP_CALL(SCIPsetObjlimit(scip,limit));
+      cutoffApplied=true;
+    }
+  }
+
+  if(interrupted or stopped) return SCIPinterruptSolve(scip);
+  return SCIP_OKAY;
+}
+
+// the constraint handler passes solutions to the separator
+static SCIP_DECL_CONSENFOLP(consEnfolpScaLP)
+{
+  (void)(scip);
+  (void)(conss);
+  (void)(nconss);
+  (void)(nusefulconss);
+  (void)(solinfeasible);
+  auto* s = reinterpret_cast<ScaLP::SolverSCIP*>(SCIPconshdlrGetData(conshdlr));
+  return s->separate(nullptr,true,SCIP_FEASIBLE,result);
+}
+
+static SCIP_DECL_CONSENFOPS(consEnfopsScaLP)
+{
+  (void)(scip);
+  (void)(conss);
+  (void)(nconss);
+  (void)(nusefulconss);
+  (void)(solinfeasible);
+  (void)(objinfeasible);
+  auto* s = reinterpret_cast<ScaLP::SolverSCIP*>(SCIPconshdlrGetData(conshdlr));
+  return s->separate(nullptr,true,SCIP_FEASIBLE,result);
+}
+
+static SCIP_DECL_CONSCHECK(consCheckScaLP)
+{
+  (void)(scip);
+  (void)(conss);
+  (void)(nconss);
+  (void)(checkintegrality);
+  (void)(checklprows);
+  (void)(printreason);
+  auto* s = reinterpret_cast<ScaLP::SolverSCIP*>(SCIPconshdlrGetData(conshdlr));
+  return s->separate(sol,false,SCIP_FEASIBLE,result);
+}
+
+// fractional solutions
+static SCIP_DECL_CONSSEPALP(consSepalpScaLP)
+{
+  (void)(scip);
+  (void)(conss);
+  (void)(nconss);
+  (void)(nusefulconss);
+  auto* s = reinterpret_cast<ScaLP::SolverSCIP*>(SCIPconshdlrGetData(conshdlr));
+  return s->separate(nullptr,true,SCIP_DIDNOTFIND,result);
+}
+
+// the handler has no constraints to lock
+static SCIP_DECL_CONSLOCK(consLockScaLP)
+{
+  (void)(scip);
+  (void)(conshdlr);
+  (void)(cons);
+  (void)(locktype);
+  (void)(nlockspos);
+  (void)(nlocksneg);
+  return SCIP_OKAY;
+}
+
+void ScaLP::SolverSCIP::freeTransform()
+{
+  if(SCIPgetStage(scip)>SCIP_STAGE_PROBLEM)
+  {
+    SCALP_SCIP_EXC(SCIPfreeTransform(scip));
+  }
+}
+
 bool ScaLP::SolverSCIP::addVariable(const ScaLP::Variable& v)
 {
+  freeTransform();
+
   SCIP_VAR* var;
   SCALP_SCIP_EXC(SCIPcreateVarBasic(scip,&var,v->getName().c_str(),
         v->getLowerBound(), v->getUpperBound(),
-        0.0, mapVariableType(v->getType())));
+        0.0, mapVariableType(typeOf(v))));
   SCALP_SCIP_EXC(SCIPaddVar(scip, var));
 
   return variables.emplace(v,var).second; // inserted correctly?
 }
 
 // add the Constraint to scip, returns the added constraint.
-static SCIP_CONS* scipAddCons(SCIP* scip, std::map<ScaLP::Variable,SCIP_VAR*> &variables, const ScaLP::Term& term, double lhs, double rhs, std::string name="")
+// (use the transformed variables while solving)
+static SCIP_CONS* scipAddCons(SCIP* scip, std::map<ScaLP::Variable,SCIP_VAR*> &variables, const ScaLP::Term& term, double lhs, double rhs, std::string name="", bool transformed=false)
 {
   SCIP_CONS* cons= nullptr;
   std::vector<SCIP_VAR*> vars;
@@ -94,7 +266,9 @@ static SCIP_CONS* scipAddCons(SCIP* scip, std::map<ScaLP::Variable,SCIP_VAR*> &v
 
   for(auto&p:term.sum)
   {
-    vars.push_back(variables.at(p.first));
+    SCIP_VAR* var = variables.at(p.first);
+    if(transformed) SCALP_SCIP_EXC(SCIPgetTransformedVar(scip,var,&var));
+    vars.push_back(var);
     vals.push_back(p.second);
   }
 
@@ -110,7 +284,8 @@ static SCIP_CONS* scipAddCons(SCIP* scip, std::map<ScaLP::Variable,SCIP_VAR*> &v
   return cons;
 }
 
-bool ScaLP::SolverSCIP::addConstraint(const ScaLP::Constraint& c)
+// the left and right hand side of c
+static std::pair<double,double> linearBounds(const ScaLP::Constraint& c)
 {
   if(c.indicator!=nullptr)
   {
@@ -121,51 +296,44 @@ bool ScaLP::SolverSCIP::addConstraint(const ScaLP::Constraint& c)
   {
     case ScaLP::Constraint::type::C2L:
     {
-      if(c.lrel==ScaLP::relation::LESS_EQ_THAN)
-      {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.lbound,ScaLP::INF(),c.name.c_str()));
-      }
-      else
-      {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.lbound,c.ubound,c.name.c_str()));
-      }
-      break;
+      if(c.lrel==ScaLP::relation::LESS_EQ_THAN) return {c.lbound,ScaLP::INF()};
+      else                                      return {c.lbound,c.ubound};
     }
     case ScaLP::Constraint::type::C2R:
     {
-      if(c.rrel==ScaLP::relation::LESS_EQ_THAN)
-      {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.lbound, c.ubound,c.name.c_str()));
-      }
-      else
-      {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.ubound,ScaLP::INF(),c.name.c_str()));
-      }
-      break;
+      if(c.rrel==ScaLP::relation::LESS_EQ_THAN) return {c.lbound,c.ubound};
+      else                                      return {c.ubound,ScaLP::INF()};
     }
     case ScaLP::Constraint::type::CEQ:
     {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.lbound, c.lbound,c.name.c_str()));
-      break;
+      return {c.lbound,c.lbound};
     }
     case ScaLP::Constraint::type::C3:
     {
       if(c.lrel==ScaLP::relation::MORE_EQ_THAN and c.rrel==ScaLP::relation::MORE_EQ_THAN)
       { // flip boundaries
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.ubound,c.lbound,c.name.c_str()));
+        return {c.ubound,c.lbound};
       }
-      else
-      {
-        constraints.push_back(scipAddCons(scip,variables,c.term,c.lbound,c.ubound,c.name.c_str()));
-      }
-      break;
+      return {c.lbound,c.ubound};
     }
   }
+  throw ScaLP::Exception("Unknown constraint type.");
+}
+
+bool ScaLP::SolverSCIP::addConstraint(const ScaLP::Constraint& c)
+{
+  std::pair<double,double> b = linearBounds(c);
+
+  freeTransform();
+
+  constraints.push_back(scipAddCons(scip,variables,c.term,b.first,b.second,c.name));
   return true;
 }
 
 bool ScaLP::SolverSCIP::setObjective(ScaLP::Objective o)
 {
+  freeTransform();
+
   if(o.getType()==ScaLP::Objective::type::MAXIMIZE)
   {
     SCALP_SCIP_EXC(SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE));
@@ -187,7 +355,27 @@ bool ScaLP::SolverSCIP::setObjective(ScaLP::Objective o)
 
 std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverSCIP::solve()
 {
-  SCALP_SCIP_EXC(SCIPsolve(scip));
+  if(cutoffApplied)
+  { // a cutoff only holds for a single solve
+    freeTransform();
+    bool maximize = SCIPgetObjsense(scip)==SCIP_OBJSENSE_MAXIMIZE;
+    SCALP_SCIP_EXC(SCIPsetObjlimit(scip,maximize?-SCIPinfinity(scip):SCIPinfinity(scip)));
+    cutoffApplied=false;
+  }
+  cutoffPending=false;
+  firstIncumbentTime=-1;
+  stopped=false;
+
+  if(dualReductions==bool(separator))
+  { // dual reductions would not respect the lazy constraints
+    freeTransform();
+    allowDualReductions(not separator);
+  }
+
+  callbackError=nullptr;
+  SCIP_RETCODE solved = SCIPsolve(scip);
+  if(callbackError) std::rethrow_exception(callbackError);
+  SCALP_SCIP_EXC(solved);
   SCIP_SOL* sol = SCIPgetBestSol(scip);
   ScaLP::Result res;
 
@@ -206,6 +394,25 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverSCIP::solve()
     // TODO: <+ Maybe create them out of the variable solutions?  +>
   }
 
+  // the transformed problem is a minimization
+  if(duals and sol!=nullptr and SCIPgetStatus(scip)==SCIP_STATUS_OPTIMAL)
+  {
+    const double sense = SCIPgetObjsense(scip)==SCIP_OBJSENSE_MAXIMIZE ? -1 : 1;
+    for(SCIP_CONS* c:constraints)
+    {
+      SCIP_CONS* t=nullptr;
+      SCALP_SCIP_EXC(SCIPgetTransformedCons(scip,c,&t));
+      res.duals.push_back(t==nullptr ? 0 : sense*SCIPgetDualsolLinear(scip,t));
+    }
+  }
+
+  res.statistics.dualBound = SCIPgetDualbound(scip) + objectiveOffset;
+  if(sol!=nullptr) res.statistics.gap = SCIPgetGap(scip);
+  res.statistics.nodes = SCIPgetNNodes(scip);
+  res.statistics.iterations = SCIPgetNLPIterations(scip);
+  res.statistics.solutions = SCIPgetNSolsFound(scip);
+  res.statistics.firstIncumbentTime = firstIncumbentTime;
+
   switch(SCIPgetStatus(scip))
   {
     case SCIP_STATUS_TIMELIMIT:
@@ -217,6 +424,11 @@ std::pair<ScaLP::status,ScaLP::Result> ScaLP::SolverSCIP::solve()
     case SCIP_STATUS_INFEASIBLE: return {ScaLP::status::INFEASIBLE,res};
     case SCIP_STATUS_INFORUNBD:  return {ScaLP::status::INFEASIBLE_OR_UNBOUND,res};
     case SCIP_STATUS_UNBOUNDED:  return {ScaLP::status::UNBOUND,res};
+    case SCIP_STATUS_USERINTERRUPT:
+      {
+        if(sol!=nullptr) return {ScaLP::status::CANCELLED_FEASIBLE,res};
+        else             return {ScaLP::status::CANCELLED_INFEASIBLE,res};
+      }
     default:
       {
         std::cerr << "Scalp: This SCIP-Status is not supported, please report with an simplified example" << std::endl;
@@ -240,18 +452,37 @@ void ScaLP::SolverSCIP::reset()
     {
       SCALP_SCIP_EXC(SCIPreleaseCons(scip,&(cons[i])));
     }
-    SCALP_SCIP_EXC(SCIPfree(&scip));
-    scip=nullptr;
+
+    // keep the instance (and the loaded plugins), only drop the problem
+    SCALP_SCIP_EXC(SCIPfreeProb(scip));
+    SCALP_SCIP_EXC(SCIPresetParams(scip));
   }
+  else
+  {
+    // create new Instance
+    SCALP_SCIP_EXC(SCIPcreate(&(this->scip)));
+    SCALP_SCIP_EXC(SCIPincludeDefaultPlugins(scip));
+
+    SCIP_EVENTHDLR* eventhdlr;
+    SCALP_SCIP_EXC(SCIPincludeEventhdlrBasic(scip,&eventhdlr,"ScaLP","incumbents and interruption",
+          eventExecScaLP,reinterpret_cast<SCIP_EVENTHDLRDATA*>(this)));
+    SCALP_SCIP_EXC(SCIPsetEventhdlrInit(scip,eventhdlr,eventInitScaLP));
+    SCALP_SCIP_EXC(SCIPsetEventhdlrExit(scip,eventhdlr,eventExitScaLP));
+
+    // called after integrality is enforced, inactive without a separator
+    SCIP_CONSHDLR* conshdlr;
+    SCALP_SCIP_EXC(SCIPincludeConshdlrBasic(scip,&conshdlr,"ScaLP","lazy constraints of a separator",
+          -1,-1,-1,false,consEnfolpScaLP,consEnfopsScaLP,consCheckScaLP,consLockScaLP,
+          reinterpret_cast<SCIP_CONSHDLRDATA*>(this)));
+    SCALP_SCIP_EXC(SCIPsetConshdlrSepa(scip,conshdlr,consSepalpScaLP,nullptr,1,0,false));
+  }
+  dualReductions=true; // the parameters are reset
+  duals=false;
 
   constraints.clear();
   variables.clear();
   objectiveOffset=0;
 
-  // create new Instance
-  SCALP_SCIP_EXC(SCIPcreate(&(this->scip)));
-  SCALP_SCIP_EXC(SCIPincludeDefaultPlugins(scip));
-
   SCALP_SCIP_EXC(SCIPcreateProbBasic(scip,"scip"));
   SCALP_SCIP_EXC(SCIPsetIntParam(scip,"timing/clocktype",2));
 }
@@ -266,6 +497,12 @@ void ScaLP::SolverSCIP::setTimeout(long timeout)
   SCALP_SCIP_EXC(SCIPsetRealParam(scip, "limits/time", timeout));
 }
 
+void ScaLP::SolverSCIP::setTimeLimit(double seconds)
+{
+  if(std::isinf(seconds)) seconds=SCIPinfinity(scip);
+  SCALP_SCIP_EXC(SCIPsetRealParam(scip, "limits/time", seconds));
+}
+
 void ScaLP::SolverSCIP::presolve(bool presolve)
 {
   if(presolve)
@@ -282,3 +519,263 @@ void ScaLP::SolverSCIP::setThreads(unsigned int t)
 {
   SCALP_SCIP_EXC(SCIPsetIntParam(scip,"lp/threads",t));
 }
+
+bool ScaLP::SolverSCIP::setVariableBounds(const ScaLP::Variable& v, double lb, double ub)
+{
+  auto it = variables.find(v);
+  if(it==variables.end()) return false;
+
+  freeTransform();
+
+  // keep lb<=ub during the change
+  if(lb>SCIPvarGetUbOriginal(it->second))
+  {
+    SCALP_SCIP_EXC(SCIPchgVarUb(scip,it->second,ub));
+    SCALP_SCIP_EXC(SCIPchgVarLb(scip,it->second,lb));
+  }
+  else
+  {
+    SCALP_SCIP_EXC(SCIPchgVarLb(scip,it->second,lb));
+    SCALP_SCIP_EXC(SCIPchgVarUb(scip,it->second,ub));
+  }
+  return true;
+}
+
+bool ScaLP::SolverSCIP::setConstraintBounds(std::size_t i, const ScaLP::Constraint& c)
+{
+  if(i>=constraints.size()) return false;
+  std::pair<double,double> b = linearBounds(c);
+  b.first-=c.term.constant;
+  b.second-=c.term.constant;
+
+  freeTransform();
+
+  // keep lhs<=rhs during the change
+  SCIP_CONS* cons = constraints[i];
+  if(b.first>SCIPgetRhsLinear(scip,cons))
+  {
+    SCALP_SCIP_EXC(SCIPchgRhsLinear(scip,cons,b.second));
+    SCALP_SCIP_EXC(SCIPchgLhsLinear(scip,cons,b.first));
+  }
+  else
+  {
+    SCALP_SCIP_EXC(SCIPchgLhsLinear(scip,cons,b.first));
+    SCALP_SCIP_EXC(SCIPchgRhsLinear(scip,cons,b.second));
+  }
+  return true;
+}
+
+bool ScaLP::SolverSCIP::removeConstraints(std::size_t n)
+{
+  if(n>constraints.size()) return false;
+
+  freeTransform();
+
+  for(std::size_t i=0;i<n;++i)
+  {
+    SCIP_CONS* c = constraints.back();
+    SCALP_SCIP_EXC(SCIPdelCons(scip,c));
+    SCALP_SCIP_EXC(SCIPreleaseCons(scip,&c));
+    constraints.pop_back();
+  }
+  return true;
+}
+
+bool ScaLP::SolverSCIP::updateObjective(ScaLP::Objective o)
+{
+  freeTransform();
+
+  if(o.getType()==ScaLP::Objective::type::MAXIMIZE)
+  {
+    SCALP_SCIP_EXC(SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE));
+  }
+  else
+  {
+    SCALP_SCIP_EXC(SCIPsetObjsense(scip, SCIP_OBJSENSE_MINIMIZE));
+  }
+
+  // SCIPchgVarObj only changes single coefficients, reset the others
+  const auto& sum = o.getTerm().sum;
+  for(auto& p:variables)
+  {
+    auto it = sum.find(p.first);
+    SCALP_SCIP_EXC(SCIPchgVarObj(scip,p.second,it==sum.end()?0.0:it->second));
+  }
+
+  objectiveOffset=o.getTerm().constant;
+
+  return true;
+}
+
+void ScaLP::SolverSCIP::setStartValues(const ScaLP::Result& start)
+{
+  freeTransform();
+
+  SCIP_SOL* sol;
+  SCALP_SCIP_EXC(SCIPcreateOrigSol(scip,&sol,nullptr));
+  for(auto& p:start.values)
+  {
+    auto it = variables.find(p.first);
+    if(it==variables.end()) continue;
+    SCALP_SCIP_EXC(SCIPsetSolVal(scip,sol,it->second,p.second));
+  }
+
+  // SCIP checks the solution and drops it if it is not feasible
+  SCIP_Bool stored;
+  SCALP_SCIP_EXC(SCIPaddSolFree(scip,&sol,&stored));
+}
+
+bool ScaLP::SolverSCIP::interrupt()
+{
+  // SCIPinterruptSolve is called by the event handler in the solving thread
+  interrupted=true;
+  return true;
+}
+
+void ScaLP::SolverSCIP::clearInterrupt()
+{
+  interrupted=false;
+}
+
+bool ScaLP::SolverSCIP::setProgressCallback(ScaLP::ProgressCallback f)
+{
+  // reported by the event handler
+  progressCallback=f;
+  return true;
+}
+
+bool ScaLP::SolverSCIP::setObjectiveCutoff(double d)
+{
+  cutoff=d;
+  cutoffPending=true;
+  return true;
+}
+
+bool ScaLP::SolverSCIP::addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients)
+{
+  if(variables.find(v)!=variables.end()) return false;
+  for(auto& p:coefficients)
+  {
+    if(p.first>=constraints.size()) return false;
+  }
+
+  addVariable(v);
+  SCIP_VAR* var = variables.at(v);
+  SCALP_SCIP_EXC(SCIPchgVarObj(scip,var,obj));
+  for(auto& p:coefficients)
+  {
+    SCALP_SCIP_EXC(SCIPaddCoefLinear(scip,constraints[p.first],var,p.second));
+  }
+  return true;
+}
+
+bool ScaLP::SolverSCIP::setDualValues(bool d)
+{
+  // the duals of the final LP belong to the model only without presolving
+  // and propagation (called after presolve(), which is overruled)
+  if(d)
+  {
+    SCALP_SCIP_EXC(SCIPsetPresolving(scip,SCIP_PARAMSETTING_OFF,true));
+    SCALP_SCIP_EXC(SCIPsetIntParam(scip,"propagating/maxrounds",0));
+    SCALP_SCIP_EXC(SCIPsetIntParam(scip,"propagating/maxroundsroot",0));
+  }
+  else if(duals)
+  {
+    SCALP_SCIP_EXC(SCIPresetParam(scip,"propagating/maxrounds"));
+    SCALP_SCIP_EXC(SCIPresetParam(scip,"propagating/maxroundsroot"));
+  }
+  duals=d;
+  return true;
+}
+
+bool ScaLP::SolverSCIP::setSeparator(ScaLP::Separator f)
+{
+  // the constraint handler is only active with a separator
+  freeTransform();
+  separator=f;
+  return true;
+}
+
+void ScaLP::SolverSCIP::allowDualReductions(bool allow)
+{
+  // SCIP 8 split the parameter
+  for(const char* p:{"misc/allowdualreds","misc/allowstrongdualreds","misc/allowweakdualreds"})
+  {
+    if(SCIPgetParam(scip,p)!=nullptr)
+    {
+      SCALP_SCIP_EXC(SCIPsetBoolParam(scip,p,allow));
+    }
+  }
+  dualReductions=allow;
+}
+
+SCIP_RETCODE ScaLP::SolverSCIP::separate(SCIP_SOL* sol, bool add, SCIP_RESULT feasible, SCIP_RESULT* result)
+{
+  *result=feasible;
+  if(not separator) return SCIP_OKAY;
+
+  ScaLP::Result res = solution(sol);
+
+  // exceptions must not pass through SCIP, solve() throws them again
+  try
+  {
+    std::vector<ScaLP::Constraint> cs = separator(res);
+    if(cs.empty()) return SCIP_OKAY;
+    if(not add)
+    {
+      *result=SCIP_INFEASIBLE;
+      return SCIP_OKAY;
+    }
+
+    for(auto& c:cs)
+    {
+      std::pair<double,double> b = linearBounds(c);
+      SCIP_CONS* cons = scipAddCons(scip,variables,c.term,b.first,b.second,c.name,true);
+      SCALP_SCIP_EXC(SCIPreleaseCons(scip,&cons));
+    }
+  }
+  catch(...)
+  {
+    callbackError=std::current_exception();
+    return SCIP_ERROR;
+  }
+
+  *result=SCIP_CONSADDED;
+  return SCIP_OKAY;
+}
+
+bool ScaLP::SolverSCIP::setSolutionPool(std::size_t n)
+{
+  // SCIP stores the feasible solutions it finds, by default up to 100
+  SCALP_SCIP_EXC(SCIPresetParam(scip,"limits/maxsol"));
+  if(n>100)
+  {
+    SCALP_SCIP_EXC(SCIPsetIntParam(scip,"limits/maxsol",static_cast<int>(std::min<std::size_t>(n,2000000000))));
+  }
+  return true;
+}
+
+std::vector<ScaLP::Result> ScaLP::SolverSCIP::getSolutions()
+{
+  // sorted by the objective value, best first
+  std::vector<ScaLP::Result> rs;
+  SCIP_SOL** sols = SCIPgetSols(scip);
+  const int n = SCIPgetNSols(scip);
+  for(int i=0;i<n;++i)
+  {
+    rs.push_back(solution(sols[i]));
+  }
+  return rs;
+}
+
+bool ScaLP::SolverSCIP::setRelaxation(bool r)
+{
+  relaxation=r;
+  freeTransform();
+  for(auto &p:variables)
+  {
+    SCIP_Bool infeasible=false;
+    SCALP_SCIP_EXC(SCIPchgVarType(scip,p.second,mapVariableType(typeOf(p.first)),&infeasible));
+  }
+  return true;
+}
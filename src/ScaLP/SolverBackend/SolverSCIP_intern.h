@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <exception>
 #include <map>
 #include <vector>
 
@@ -26,11 +28,58 @@ namespace ScaLP
       virtual void reset() override;
       virtual void setConsoleOutput(bool verbose) override;
       virtual void setTimeout(long timeout) override;
+      virtual void setTimeLimit(double seconds) override;
       virtual void presolve(bool presolve) override;
       virtual void setThreads(unsigned int t) override;
+      virtual bool setVariableBounds(const ScaLP::Variable& v, double lb, double ub) override;
+      virtual bool setConstraintBounds(std::size_t i, const ScaLP::Constraint& c) override;
+      virtual bool removeConstraints(std::size_t n) override;
+      virtual bool updateObjective(ScaLP::Objective o) override;
+      virtual bool addColumn(const ScaLP::Variable& v, double obj, const std::vector<std::pair<std::size_t,double>>& coefficients) override;
+      virtual bool setDualValues(bool d) override;
+      virtual void setStartValues(const ScaLP::Result& start) override;
+      virtual bool interrupt() override;
+      virtual void clearInterrupt() override;
+      virtual bool setObjectiveCutoff(double d) override;
+      virtual bool setProgressCallback(ScaLP::ProgressCallback f) override;
+      virtual bool setSeparator(ScaLP::Separator f) override;
+      virtual bool setSolutionPool(std::size_t n) override;
+      virtual std::vector<ScaLP::Result> getSolutions() override;
+      virtual bool setRelaxation(bool r) override;
+
+      // called by the event handler
+      SCIP_RETCODE processEvent(SCIP_EVENT* event);
+
+      // called by the constraint handler, passes sol (nullptr: the current
+      // LP-solution) to the separator and adds the violated constraints
+      // if add is set, otherwise result is SCIP_INFEASIBLE for them.
+      SCIP_RETCODE separate(SCIP_SOL* sol, bool add, SCIP_RESULT feasible, SCIP_RESULT* result);
 
       SCIP *scip=nullptr;
       std::map<ScaLP::Variable,SCIP_VAR*> variables;
       std::vector<SCIP_CONS*> constraints;
+
+    private:
+      // return to the problem stage to allow modifications after solving
+      void freeTransform();
+
+      // the values of sol (of the original problem)
+      ScaLP::Result solution(SCIP_SOL* sol);
+
+      std::atomic<bool> interrupted{false};
+
+      // the cutoff is applied by the event handler in the solving thread
+      std::atomic<double> cutoff{0};
+      std::atomic<bool> cutoffPending{false};
+      bool cutoffApplied=false;
+
+      double firstIncumbentTime=-1; // solving time at the first solution
+      bool stopped=false;           // the progress callback stopped the solve
+
+      ScaLP::Separator separator;
+      std::exception_ptr callbackError; // thrown by a callback while solving
+      bool dualReductions=true;
+      bool duals=false; // fill ScaLP::Result::duals
+      void allowDualReductions(bool allow);
   };
 }
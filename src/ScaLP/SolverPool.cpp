@@ -0,0 +1,342 @@
+
+#include <ScaLP/SolverPool.h>
+#include <ScaLP/Solver.h>
+#include <ScaLP/Exception.h>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <map>
+
+static unsigned int workerCount(unsigned int workers)
+{
+  if(workers>0) return workers;
+  unsigned int n = std::thread::hardware_concurrency();
+  return n>0 ? n : 1;
+}
+
+ScaLP::SolverPool::SolverPool(std::list<std::string> ls, unsigned int workers)
+  : SolverPool(std::list<ScaLP::Feature>(),ls,workers)
+{
+}
+
+ScaLP::SolverPool::SolverPool(std::list<ScaLP::Feature> fs, std::list<std::string> ls, unsigned int workers)
+{
+  // the backends are loaded here, so a missing backend throws in the caller
+  std::vector<std::unique_ptr<ScaLP::Solver>> ss;
+  for(unsigned int i=0;i<workerCount(workers);++i)
+  {
+    ss.emplace_back(new ScaLP::Solver(fs,ls));
+  }
+  start(std::move(ss));
+}
+
+ScaLP::SolverPool::SolverPool(std::function<ScaLP::SolverBackend*()> factory, unsigned int workers)
+{
+  std::vector<std::unique_ptr<ScaLP::Solver>> ss;
+  for(unsigned int i=0;i<workerCount(workers);++i)
+  {
+    ss.emplace_back(new ScaLP::Solver(factory()));
+  }
+  start(std::move(ss));
+}
+
+ScaLP::SolverPool::~SolverPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop=true;
+  }
+  available.notify_all();
+  for(auto& t:workerThreads) t.join();
+}
+
+void ScaLP::SolverPool::start(std::vector<std::unique_ptr<ScaLP::Solver>>&& ss)
+{
+  solvers=std::move(ss);
+  for(std::size_t i=0;i<solvers.size();++i)
+  {
+    queues.emplace_back(new Queue());
+  }
+  for(std::size_t i=0;i<solvers.size();++i)
+  {
+    workerThreads.emplace_back(&ScaLP::SolverPool::run,this,i);
+  }
+}
+
+std::future<ScaLP::SolverPool::Outcome> ScaLP::SolverPool::submit(const ScaLP::Objective& o, ScaLP::ModelBuilder&& m)
+{
+  Job j{o,std::move(m),std::make_shared<std::promise<Outcome>>(),nullptr};
+  std::future<Outcome> f = j.promise->get_future();
+  enqueue(std::move(j));
+  return f;
+}
+
+void ScaLP::SolverPool::submit(const ScaLP::Objective& o, ScaLP::ModelBuilder&& m, Callback f)
+{
+  enqueue(Job{o,std::move(m),nullptr,std::move(f)});
+}
+
+void ScaLP::SolverPool::enqueue(Job&& j)
+{
+  std::size_t q;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    q = next++ % queues.size();
+    ++pending;
+  }
+  {
+    std::lock_guard<std::mutex> lock(queues[q]->mutex);
+    queues[q]->jobs.push_back(std::move(j));
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++queued;
+  }
+  available.notify_one();
+}
+
+// take the oldest job of the own queue or the newest job of another queue
+bool ScaLP::SolverPool::take(std::size_t worker, Job& j)
+{
+  for(std::size_t k=0;k<queues.size();++k)
+  {
+    Queue& q = *queues[(worker+k)%queues.size()];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if(q.jobs.empty()) continue;
+
+    if(k==0)
+    {
+      j=std::move(q.jobs.front());
+      q.jobs.pop_front();
+    }
+    else
+    {
+      j=std::move(q.jobs.back());
+      q.jobs.pop_back();
+    }
+    return true;
+  }
+  return false;
+}
+
+void ScaLP::SolverPool::run(std::size_t worker)
+{
+  while(true)
+  {
+    std::size_t n;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      available.wait(lock,[this]{return stop or queued>0;});
+      if(queued==0) return; // stop and nothing left
+      n = std::min(queued,std::max<std::size_t>(batchSize,1));
+      queued-=n;
+    }
+
+    // the jobs are reserved, but they may be in a queue which is still locked.
+    std::vector<Job> js(n);
+    for(auto& j:js)
+    {
+      while(not take(worker,j)) std::this_thread::yield();
+    }
+
+    if(n==1) execute(*solvers[worker],js.front());
+    else execute(*solvers[worker],js);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending-=n;
+      if(pending==0) idle.notify_all();
+    }
+  }
+}
+
+void ScaLP::SolverPool::configure(ScaLP::Solver& s) const
+{
+  s.quiet=quiet;
+  s.timeout=timeout;
+  s.deadline=deadline;
+  s.presolve=presolve;
+  s.threads=threads;
+  s.scheduler=scheduler;
+  s.dualValues=dualValues;
+}
+
+// an exception of the callback would end the worker thread
+static void call(const ScaLP::SolverPool::Callback& f, ScaLP::status stat, const ScaLP::Result& res)
+{
+  try
+  {
+    f(stat,res);
+  }
+  catch(std::exception& e)
+  {
+    std::cerr << "ScaLP: the callback of a pool job threw, ignore it: " << e.what() << std::endl;
+  }
+  catch(...)
+  {
+    std::cerr << "ScaLP: the callback of a pool job threw, ignore it." << std::endl;
+  }
+}
+
+static void deliver(std::promise<ScaLP::SolverPool::Outcome>* p, const ScaLP::SolverPool::Callback& f, ScaLP::SolverPool::Outcome&& out)
+{
+  if(p!=nullptr)
+  {
+    p->set_value(std::move(out));
+  }
+  else if(f)
+  {
+    call(f,out.first,out.second);
+  }
+}
+
+void ScaLP::SolverPool::execute(ScaLP::Solver& s, Job& j)
+{
+  Outcome out{ScaLP::status::ERROR,ScaLP::Result()};
+  try
+  {
+    configure(s);
+    s.reset();
+    s.setObjective(j.objective);
+    s.merge(std::move(j.model));
+    out.first = s.solve();
+    out.second = s.getResult();
+  }
+  catch(...)
+  {
+    if(j.promise)
+    {
+      j.promise->set_exception(std::current_exception());
+    }
+    else if(j.callback)
+    {
+      call(j.callback,ScaLP::status::ERROR,ScaLP::Result());
+    }
+    return;
+  }
+
+  deliver(j.promise.get(),j.callback,std::move(out));
+}
+
+// copy t with the renamed variables (created on first use)
+static ScaLP::Term rename(const ScaLP::Term& t, const std::string& prefix, std::map<ScaLP::Variable,ScaLP::Variable>& names)
+{
+  ScaLP::Term r(t.constant);
+  for(auto& p:t.sum)
+  {
+    auto it = names.find(p.first);
+    if(it==names.end())
+    {
+      const ScaLP::Variable& v = p.first;
+      it = names.emplace(v,ScaLP::newVariable(prefix+v->getName(),v->getLowerBound(),v->getUpperBound(),v->getType())).first;
+    }
+    r.add(it->second,p.second);
+  }
+  return r;
+}
+
+static ScaLP::Constraint rename(const ScaLP::Constraint& c, const std::string& prefix, std::map<ScaLP::Variable,ScaLP::Variable>& names)
+{
+  ScaLP::Constraint r(c);
+  r.term = rename(c.term,prefix,names);
+  if(c.indicator!=nullptr)
+  {
+    r.indicator = std::make_shared<ScaLP::Constraint>(rename(*c.indicator,prefix,names));
+  }
+  return r;
+}
+
+// solve the jobs as one block-diagonal model (minimizing the sum of the
+// objectives, maximized ones are negated) and split the result
+void ScaLP::SolverPool::execute(ScaLP::Solver& s, std::vector<Job>& js)
+{
+  std::vector<Outcome> outs;
+  try
+  {
+    configure(s);
+    s.reset();
+
+    std::vector<std::map<ScaLP::Variable,ScaLP::Variable>> names(js.size());
+    std::vector<ScaLP::Term> objectives;
+    std::vector<ScaLP::ModelBuilder> blocks(js.size());
+    ScaLP::Term sum;
+    for(std::size_t k=0;k<js.size();++k)
+    {
+      const std::string prefix = "b"+std::to_string(k)+"_";
+      objectives.push_back(js[k].objective.getTerm()+js[k].model.getObjectiveTerm());
+      const double sign = js[k].objective.getType()==ScaLP::Objective::type::MAXIMIZE ? -1 : 1;
+      ScaLP::Term t = rename(objectives.back(),prefix,names[k]);
+      t.constant=0;
+      sum += sign*t;
+
+      blocks[k].setConstraintCount(js[k].model.getConstraintCount());
+      for(auto& c:js[k].model.getConstraints())
+      {
+        blocks[k] << rename(c,prefix,names[k]);
+      }
+    }
+    s.setObjective(ScaLP::minimize(sum));
+    s.merge(std::move(blocks));
+
+    if(s.solve()==ScaLP::status::OPTIMAL)
+    {
+      const ScaLP::Result res = s.getResult();
+      std::size_t offset=0;
+      for(std::size_t k=0;k<js.size();++k)
+      {
+        const double sign = js[k].objective.getType()==ScaLP::Objective::type::MAXIMIZE ? -1 : 1;
+        Outcome out{ScaLP::status::OPTIMAL,ScaLP::Result()};
+        ScaLP::Result& r = out.second;
+        r.objectiveValue = objectives[k].constant;
+        for(auto& p:names[k])
+        {
+          const double v = res.values.at(p.second);
+          r.values.emplace(p.first,v);
+          r.objectiveValue += objectives[k].getCoefficient(p.first)*v;
+          auto it = res.reducedCosts.find(p.second);
+          if(it!=res.reducedCosts.end()) r.reducedCosts.emplace(p.first,sign*it->second);
+        }
+        const std::size_t count = js[k].model.getConstraintCount();
+        if(res.duals.size()>=offset+count)
+        {
+          for(std::size_t i=offset;i<offset+count;++i) r.duals.push_back(sign*res.duals[i]);
+        }
+        offset+=count;
+        outs.push_back(std::move(out));
+      }
+    }
+  }
+  catch(...)
+  {
+    outs.clear();
+  }
+
+  // solve them one by one to get the status of every model
+  if(outs.empty())
+  {
+    for(auto& j:js) execute(s,j);
+    return;
+  }
+
+  for(std::size_t k=0;k<js.size();++k)
+  {
+    deliver(js[k].promise.get(),js[k].callback,std::move(outs[k]));
+  }
+}
+
+void ScaLP::SolverPool::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  idle.wait(lock,[this]{return pending==0;});
+}
+
+std::size_t ScaLP::SolverPool::size() const
+{
+  return solvers.size();
+}
+
+std::string ScaLP::SolverPool::getBackendName() const
+{
+  return solvers.front()->getBackendName();
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ScaLP/ModelBuilder.h>
+#include <ScaLP/Objective.h>
+#include <ScaLP/Result.h>
+#include <ScaLP/SolverBackend.h>
+#include <ScaLP/ThreadScheduler.h>
+
+namespace ScaLP
+{
+  class Solver;
+
+  // A fixed number of worker threads which solve many independent models.
+  // Every worker keeps its own ScaLP::Solver (and backend), so the backend is
+  // loaded once per worker instead of once per model.
+  // Models are distributed round-robin, idle workers steal from the others.
+  class SolverPool
+  {
+    public:
+      // status and result of a single model
+      using Outcome = std::pair<ScaLP::status,ScaLP::Result>;
+      using Callback = std::function<void(ScaLP::status, const ScaLP::Result&)>;
+
+      // create the workers with the given backends (see ScaLP::Solver).
+      // zero workers means one per hardware thread.
+      SolverPool(std::list<std::string> ls, unsigned int workers=0);
+      SolverPool(std::list<ScaLP::Feature> fs, std::list<std::string> ls, unsigned int workers=0);
+
+      // create the workers with backends of the factory
+      // (called once per worker, the memory is managed by the pool)
+      SolverPool(std::function<ScaLP::SolverBackend*()> factory, unsigned int workers=0);
+
+      // finishes all submitted models
+      ~SolverPool();
+
+      SolverPool(const SolverPool&) = delete;
+      SolverPool& operator=(const SolverPool&) = delete;
+
+      //####################
+      // Parameters
+      //####################
+
+      // the parameters are applied by the worker for every model
+      // (change them only while no model is pending)
+      bool quiet = true;
+
+      // timeout per model in seconds, zero is no limit.
+      long timeout = 0;
+
+      // deadline of every model (see ScaLP::Solver::deadline)
+      std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+      bool presolve = true;
+
+      // threads used by each backend (0 is the default of the backend).
+      // Set it to 1 for multi-threaded backends to avoid oversubscription.
+      int threads = 0;
+
+      // the scheduler of the threads (see ScaLP::Solver::scheduler)
+      ScaLP::ThreadScheduler* scheduler = nullptr;
+
+      // compute dual values of LPs (see ScaLP::Solver::dualValues)
+      bool dualValues = false;
+
+      // solve up to batchSize queued models at once: the models are renamed
+      // and stacked into one block-diagonal model (the objectives are
+      // summed), which saves the setup of the backend for tiny models.
+      // If the stacked model is not solved to optimality, the models are
+      // solved again one by one to get their own status.
+      // (the MIP-gap of the backend applies to the sum of the objectives)
+      std::size_t batchSize = 1;
+
+
+      //####################
+      // Solving
+      //####################
+
+      // solve the model (the constraints of the builder) with the given
+      // objective. Objective terms of the builder are added to the objective.
+      std::future<Outcome> submit(const ScaLP::Objective& o, ScaLP::ModelBuilder&& m);
+
+      // like above, but call f in the worker thread instead of using a future.
+      // exceptions are reported as status ERROR, exceptions of f are
+      // ignored.
+      void submit(const ScaLP::Objective& o, ScaLP::ModelBuilder&& m, Callback f);
+
+      // wait until all submitted models are solved
+      void wait();
+
+      // the number of worker threads
+      std::size_t size() const;
+
+      std::string getBackendName() const;
+
+    private:
+      struct Job
+      {
+        ScaLP::Objective objective;
+        ScaLP::ModelBuilder model;
+        std::shared_ptr<std::promise<Outcome>> promise;
+        Callback callback;
+      };
+
+      struct Queue
+      {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+      };
+
+      void start(std::vector<std::unique_ptr<ScaLP::Solver>>&& solvers);
+      void enqueue(Job&& j);
+      bool take(std::size_t worker, Job& j);
+      void run(std::size_t worker);
+      void configure(ScaLP::Solver& s) const;
+      void execute(ScaLP::Solver& s, Job& j);
+      void execute(ScaLP::Solver& s, std::vector<Job>& js);
+
+      std::vector<std::unique_ptr<ScaLP::Solver>> solvers;
+      std::vector<std::unique_ptr<Queue>> queues;
+      std::vector<std::thread> workerThreads;
+
+      std::mutex mutex;
+      std::condition_variable available; // a job was queued or stop was set
+      std::condition_variable idle;      // all jobs are done
+      std::size_t queued=0;  // jobs in the queues
+      std::size_t pending=0; // queued or running jobs
+      std::size_t next=0;    // queue for the next job
+      bool stop=false;
+  };
+
+}
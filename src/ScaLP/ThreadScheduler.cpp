@@ -0,0 +1,205 @@
+
+#include <ScaLP/ThreadScheduler.h>
+
+#include <algorithm>
+#include <thread>
+
+static unsigned int hardwareThreads()
+{
+  unsigned int n = std::thread::hardware_concurrency();
+  return n>0 ? n : 1;
+}
+
+ScaLP::ThreadScheduler::ThreadScheduler(unsigned int b)
+  : budget(b>0 ? b : hardwareThreads()), last(Clock::now())
+{
+}
+
+ScaLP::ThreadScheduler& ScaLP::ThreadScheduler::global()
+{
+  static ScaLP::ThreadScheduler s;
+  return s;
+}
+
+// r is the most urgent waiting request
+bool ScaLP::ThreadScheduler::first(const Request& r) const
+{
+  for(auto& w:waiting)
+  {
+    if(w.priority!=r.priority)
+    {
+      if(w.priority>r.priority) return false;
+      continue;
+    }
+    if(w.deadline!=r.deadline)
+    {
+      if(w.deadline<r.deadline) return false;
+      continue;
+    }
+    if(w.ticket<r.ticket) return false;
+  }
+  return true;
+}
+
+// integrate the used threads over time
+void ScaLP::ThreadScheduler::account(Clock::time_point now)
+{
+  const double d = std::chrono::duration<double>(now-last).count();
+  busy += d*used;
+  capacity += d*budget;
+  last = now;
+}
+
+ScaLP::ThreadScheduler::Allocation ScaLP::ThreadScheduler::acquire(unsigned int requested, int priority, Clock::time_point deadline)
+{
+  const Clock::time_point start = Clock::now();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  waiting.push_back(Request{priority,deadline,tickets++});
+  auto it = std::prev(waiting.end());
+
+  auto ready = [&,this]{return used<budget and first(*it);};
+  if(deadline==Clock::time_point::max()) changed.wait(lock,ready);
+  else if(not changed.wait_until(lock,deadline,ready))
+  {
+    // the deadline passed, the next request may be served now
+    waiting.erase(it);
+    changed.notify_all();
+    return Allocation();
+  }
+
+  // a fair share of the budget between the running and the waiting solves
+  const unsigned int free = budget-used;
+  const unsigned int solves = static_cast<unsigned int>(running+waiting.size());
+  unsigned int n = std::max(1u,std::min(free,budget/solves));
+  n = std::min(n,limit>0 ? limit : std::max(1u,(budget+1)/2));
+  if(requested>0) n = std::min(n,requested);
+
+  const Clock::time_point now = Clock::now();
+  account(now);
+  waiting.erase(it);
+  used += n;
+  ++running;
+  ++granted;
+  waitingTime += std::chrono::duration<double>(now-start).count();
+
+  // the next request may be served too
+  changed.notify_all();
+
+  Allocation a;
+  a.scheduler=this;
+  a.count=n;
+  return a;
+}
+
+void ScaLP::ThreadScheduler::release(unsigned int n)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    account(Clock::now());
+    used -= n;
+    --running;
+  }
+  changed.notify_all();
+}
+
+void ScaLP::ThreadScheduler::setBudget(unsigned int b)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    account(Clock::now());
+    budget = b>0 ? b : hardwareThreads();
+  }
+  changed.notify_all();
+}
+
+unsigned int ScaLP::ThreadScheduler::getBudget() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return budget;
+}
+
+void ScaLP::ThreadScheduler::setLimitPerSolve(unsigned int l)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  limit=l;
+}
+
+ScaLP::ThreadScheduler::Metrics ScaLP::ThreadScheduler::metrics() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  Metrics m;
+  m.budget=budget;
+  m.used=used;
+  m.running=running;
+  m.waiting=waiting.size();
+  m.granted=granted;
+  m.waitingTime=waitingTime;
+
+  // include the time since the last change
+  const double d = std::chrono::duration<double>(Clock::now()-last).count();
+  const double c = capacity+d*budget;
+  m.utilization = c>0 ? (busy+d*used)/c : 0;
+  return m;
+}
+
+void ScaLP::ThreadScheduler::resetMetrics()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  granted=0;
+  waitingTime=0;
+  busy=0;
+  capacity=0;
+  last=Clock::now();
+}
+
+ScaLP::ThreadScheduler::Allocation::Allocation(Allocation&& a)
+  : scheduler(a.scheduler), count(a.count)
+{
+  a.scheduler=nullptr;
+  a.count=0;
+}
+
+ScaLP::ThreadScheduler::Allocation& ScaLP::ThreadScheduler::Allocation::operator=(Allocation&& a)
+{
+  if(this!=&a)
+  {
+    release();
+    scheduler=a.scheduler;
+    count=a.count;
+    a.scheduler=nullptr;
+    a.count=0;
+  }
+  return *this;
+}
+
+ScaLP::ThreadScheduler::Allocation::~Allocation()
+{
+  release();
+}
+
+unsigned int ScaLP::ThreadScheduler::Allocation::threads() const
+{
+  return count;
+}
+
+void ScaLP::ThreadScheduler::Allocation::release()
+{
+  if(scheduler!=nullptr)
+  {
+    scheduler->release(count);
+    scheduler=nullptr;
+    count=0;
+  }
+}
+
+std::ostream& ScaLP::operator<<(std::ostream& os, const ScaLP::ThreadScheduler::Metrics& m)
+{
+  return os
+    << "Threads used:  " << m.used << "/" << m.budget << "\n"
+    << "Running:       " << m.running << "\n"
+    << "Waiting:       " << m.waiting << "\n"
+    << "Granted:       " << m.granted << "\n"
+    << "Waiting time:  " << m.waitingTime << "s\n"
+    << "Utilization:   " << m.utilization*100 << "%\n";
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <ostream>
+
+namespace ScaLP
+{
+
+  // Distributes a budget of threads between concurrent solves.
+  // A solve acquires an allocation before it starts and passes its size to
+  // the backend (see ScaLP::Solver::scheduler). If no thread is free, the
+  // solve waits until other solves release theirs. Waiting solves are served
+  // by priority (higher first), then by deadline (earlier first).
+  // Running solves keep their allocation, released threads go to the waiting
+  // solves. A solve gets at most its share of the budget (divided by the
+  // running and waiting solves) and the limit per solve.
+  class ThreadScheduler
+  {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      // a budget of zero uses the number of hardware threads
+      explicit ThreadScheduler(unsigned int budget=0);
+
+      // a scheduler shared by the whole process
+      static ThreadScheduler& global();
+
+      // the threads of an acquired allocation, released by the destructor
+      class Allocation
+      {
+        public:
+          Allocation() = default;
+          Allocation(Allocation&& a);
+          Allocation& operator=(Allocation&& a);
+          Allocation(const Allocation&) = delete;
+          Allocation& operator=(const Allocation&) = delete;
+          ~Allocation();
+
+          unsigned int threads() const;
+
+          // return the threads to the scheduler
+          void release();
+
+        private:
+          friend class ThreadScheduler;
+          ThreadScheduler* scheduler=nullptr;
+          unsigned int count=0;
+      };
+
+      // wait until threads are available and return at most requested threads
+      // (zero means as many as possible).
+      // An allocation without threads is returned if the deadline passes.
+      Allocation acquire(unsigned int requested=0, int priority=0
+        , Clock::time_point deadline=Clock::time_point::max());
+
+      // change the budget (allocations exceeding it are not revoked)
+      void setBudget(unsigned int budget);
+      unsigned int getBudget() const;
+
+      // the maximum number of threads of a single allocation
+      // (zero means half of the budget, so a second solve does not wait for
+      // the first one; use getBudget() to allow the whole budget)
+      void setLimitPerSolve(unsigned int limit);
+
+      struct Metrics
+      {
+        unsigned int budget=0;
+        unsigned int used=0;        // threads allocated right now
+        std::size_t running=0;      // solves holding an allocation
+        std::size_t waiting=0;      // solves waiting for threads
+        std::size_t granted=0;      // allocations since the last reset
+        double waitingTime=0;       // sum of the waiting times (seconds)
+        double utilization=0;       // allocated thread-seconds / budget-seconds
+      };
+      Metrics metrics() const;
+
+      // restart the accumulated values of the metrics
+      void resetMetrics();
+
+    private:
+      struct Request
+      {
+        int priority;
+        Clock::time_point deadline;
+        unsigned long long ticket;
+      };
+
+      void release(unsigned int n);
+      bool first(const Request& r) const;
+      void account(Clock::time_point now);
+
+      mutable std::mutex mutex;
+      std::condition_variable changed;
+
+      unsigned int budget;
+      unsigned int limit=0;
+      unsigned int used=0;
+      std::size_t running=0;
+      std::list<Request> waiting;
+      unsigned long long tickets=0;
+
+      // metrics
+      std::size_t granted=0;
+      double waitingTime=0;
+      double busy=0;     // allocated thread-seconds
+      double capacity=0; // budget-seconds
+      Clock::time_point last;
+  };
+
+  std::ostream& operator<<(std::ostream& os, const ThreadScheduler::Metrics& m);
+
+}
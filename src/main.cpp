@@ -2,6 +2,7 @@
 #include <string>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 #include "ScaLP/Exception.h"
 #include "ScaLP/Solver.h"
@@ -13,6 +14,9 @@
 void printHelp()
 {
   std::cout << "Usage:" << std::endl << "  $ scalp [-s SolverName] file.lp [output]" << std::endl;
+  std::cout << "  $ scalp --statistics file.lp" << std::endl;
+  std::cout << "    print the model statistics without solving" << std::endl
+            << "    (returns 2 if the model looks numerically unstable)" << std::endl;
 }
 
 std::tuple<std::string,std::string,std::string> parseCommandLine(int argc, char** argv)
@@ -55,15 +59,56 @@ void printSolution(ScaLP::status stat, ScaLP::Result& result)
   std::cout << result << std::endl;
 }
 
+#ifdef LP_PARSER
+// largest reasonable ratio of the absolute coefficients
+static const double maxCoefficientRange = 1e9;
+
+int printStatistics(const std::string& file)
+{
+  ScaLP::Solver s(nullptr); // no backend needed
+  if(not s.load(file)) return -1;
+
+  const ScaLP::ModelStatistics& st = s.statistics();
+  std::cout << st;
+
+  if(st.coefficientRange()>maxCoefficientRange)
+  {
+    std::cerr << "Warning: the coefficient range (" << st.coefficientRange()
+              << ") exceeds " << maxCoefficientRange
+              << ", the model is likely to be numerically unstable" << std::endl;
+    return 2;
+  }
+  return 0;
+}
+#endif
+
 int main(int argc, char** argv)
 {
+  // filter the --statistics flag
+  bool statistics=false;
+  std::vector<char*> args;
+  for(int i=0;i<argc;++i)
+  {
+    if(std::string(argv[i])=="--statistics") statistics=true;
+    else args.push_back(argv[i]);
+  }
 
-  auto conf = parseCommandLine(argc,argv);
+  auto conf = parseCommandLine(args.size(),args.data());
   if(std::get<1>(conf).empty()) return -1; // command line error (no file)
 
+#ifndef LP_PARSER
+  if(statistics)
+  {
+    std::cerr << "--statistics needs the LP parser, build scalp with it" << std::endl;
+    return -1;
+  }
+#endif
+
 #ifdef LP_PARSER
   try
   {
+    if(statistics) return printStatistics(std::get<1>(conf));
+
     ScaLP::Solver s{std::get<0>(conf)};
     //std::cout << s.getBackendName() << std::endl;
 
@@ -0,0 +1,81 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+#include <ScaLP/Benders.h>
+
+// facility location with two demand scenarios:
+// the facilities are opened in the master, the supply is planned per scenario
+template<class S>
+static std::vector<ScaLP::Variable> build(S& s)
+{
+  const double fixed[3]    = {7,5,9};
+  const double capacity[3] = {6,4,8};
+  const double cost[3]     = {1,1.5,0.5};
+  const double demand[2]   = {5,9};
+
+  std::vector<ScaLP::Variable> open;
+  ScaLP::Term objective;
+  ScaLP::Term opened;
+  for(int i=0;i<3;++i)
+  {
+    open.push_back(ScaLP::newBinaryVariable("open_"+std::to_string(i)));
+    objective += fixed[i]*open[i];
+    opened += open[i];
+  }
+  s << (opened <= 2);
+
+  for(int k=0;k<2;++k)
+  {
+    ScaLP::Term supply;
+    for(int i=0;i<3;++i)
+    {
+      ScaLP::Variable y = ScaLP::newRealVariable("y_"+std::to_string(i)+"_"+std::to_string(k),0,20);
+      supply += y;
+      objective += cost[i]*y;
+      s << (y - capacity[i]*open[i] <= 0);
+    }
+    s << (supply >= demand[k]);
+  }
+  s.setObjective(ScaLP::minimize(objective));
+  return open;
+}
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver whole{argv[1]};
+  std::cout << whole.getBackendName() << std::endl;
+  build(whole);
+  if(whole.solve()!=ScaLP::status::OPTIMAL) return 1;
+
+  ScaLP::Benders b{argv[1]};
+  for(auto& v:build(b)) b.addMasterVariable(v);
+
+  std::size_t calls=0;
+  b.setProgressCallback([&calls](const ScaLP::BendersIteration& i)
+  {
+    std::cout << "iteration " << i.iteration << ": bound " << i.bound << ", incumbent " << i.incumbent << std::endl;
+    ++calls;
+    return true;
+  });
+
+  ScaLP::status stat = b.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 2;
+
+  ScaLP::Result res = b.getResult();
+  std::cout << res << std::endl;
+  if(std::abs(res.objectiveValue-whole.getResult().objectiveValue)>1e-6) return 3;
+  if(res.values.size()!=9) return 4;
+  if(calls!=b.getIterations().size() or calls<2) return 5;
+
+  // the bounds converge
+  const ScaLP::BendersIteration& last = b.getIterations().back();
+  if(not (last.gap<=b.tolerance) and last.optimalityCuts!=0) return 6;
+
+  return 0;
+}
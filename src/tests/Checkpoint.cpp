@@ -0,0 +1,97 @@
+
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdlib>
+
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <ScaLP/Solver.h>
+
+// the number of cache entries with the file f
+static int entries(const std::string& dir, const std::string& f)
+{
+  int n=0;
+  DIR* d = opendir(dir.c_str());
+  if(d==nullptr) return 0;
+  while(dirent* e = readdir(d))
+  {
+    if(std::ifstream(dir+"/"+e->d_name+"/"+f).good()) ++n;
+  }
+  closedir(d);
+  return n;
+}
+
+static void build(ScaLP::Solver& s, const std::string& dir)
+{
+  static std::vector<ScaLP::Variable> x;
+  const int n=20;
+  ScaLP::Term weight;
+  ScaLP::Term value;
+  for(int i=0;i<n;++i)
+  {
+    if(x.size()<=std::size_t(i)) x.push_back(ScaLP::newBinaryVariable("x"+std::to_string(i)));
+    weight += (10+(i*7)%13)*x[i];
+    value  += (10+(i*11)%17)*x[i];
+  }
+  s.setObjective(ScaLP::maximize(value));
+  s << (weight <= 100);
+  s.quiet=true;
+  s.resultCache.directory=dir;
+  s.resultCache.checkpoints=true;
+}
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  char tmp[] = "/tmp/scalp-checkpoint-XXXXXX";
+  if(mkdtemp(tmp)==nullptr) return 1;
+  const std::string dir = tmp;
+
+  // the reference without cache
+  ScaLP::Solver ref{argv[1]};
+  std::cout << ref.getBackendName() << std::endl;
+  build(ref,"");
+  if(ref.solve()!=ScaLP::status::OPTIMAL) return 2;
+
+  // a process killed at its first incumbent
+  pid_t pid = fork();
+  if(pid==0)
+  {
+    ScaLP::Solver s{argv[1]};
+    build(s,dir);
+    s.setProgressCallback([](const ScaLP::Progress& p)
+    {
+      if(p.incumbent!=nullptr) _exit(0);
+      return true;
+    });
+    s.solve();
+    _exit(3); // no incumbent was reported
+  }
+  int state=0;
+  waitpid(pid,&state,0);
+  if(not WIFEXITED(state)) return 3;
+  if(WEXITSTATUS(state)==3)
+  {
+    std::cout << "the backend does not report incumbents" << std::endl;
+    std::system(("rm -rf \""+dir+"\"").c_str());
+    return 0;
+  }
+  if(entries(dir,"checkpoint.sol")!=1) return 4;
+
+  // the next solve starts from the checkpoint and removes it
+  ScaLP::Solver s{argv[1]};
+  build(s,dir);
+  ScaLP::status stat = s.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 5;
+  if(std::abs(s.getResult().objectiveValue-ref.getResult().objectiveValue)>1e-6) return 6;
+  if(entries(dir,"checkpoint.sol")!=0 or entries(dir,"optimal.sol")!=1) return 7;
+
+  std::system(("rm -rf \""+dir+"\"").c_str());
+  return 0;
+}
@@ -0,0 +1,103 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+#include <ScaLP/Exception.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  s.presolve=false;
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  // cutting stock: cut pieces of the given widths out of as few rolls as possible
+  const int roll=10;
+  const std::vector<int> width{3,4,5};
+  const std::vector<int> demand{9,6,4};
+
+  // start with one pattern per width
+  ScaLP::Term rolls;
+  std::vector<ScaLP::Term> produced(width.size());
+  for(std::size_t i=0;i<width.size();++i)
+  {
+    ScaLP::Variable p = ScaLP::newRealVariable("p"+std::to_string(i),0,ScaLP::INF());
+    rolls += p;
+    produced[i] += (roll/width[i])*p;
+  }
+  s.setObjective(ScaLP::minimize(rolls));
+  for(std::size_t i=0;i<width.size();++i)
+  {
+    s << (produced[i] >= demand[i]);
+  }
+
+  // the pattern with the highest value by enumeration
+  int patterns=0;
+  auto pricing = [&](const ScaLP::Result& r)
+  {
+    std::vector<ScaLP::Column> columns;
+    if(r.duals.size()!=width.size()) return columns;
+
+    double best=1;
+    std::vector<int> bestCount;
+    for(int a=0;a*width[0]<=roll;++a)
+      for(int b=0;a*width[0]+b*width[1]<=roll;++b)
+        for(int c=0;a*width[0]+b*width[1]+c*width[2]<=roll;++c)
+        {
+          double value = a*r.duals[0]+b*r.duals[1]+c*r.duals[2];
+          if(value>best+1e-6)
+          {
+            best=value;
+            bestCount={a,b,c};
+          }
+        }
+
+    if(not bestCount.empty())
+    {
+      ScaLP::Column col(ScaLP::newRealVariable("q"+std::to_string(patterns++),0,ScaLP::INF()),1);
+      for(std::size_t i=0;i<width.size();++i)
+      {
+        if(bestCount[i]>0) col.coefficients.emplace_back(i,bestCount[i]);
+      }
+      columns.push_back(col);
+    }
+    return columns;
+  };
+
+  ScaLP::status stat;
+  try
+  {
+    stat = s.solveWithColumnGeneration(pricing);
+  }
+  catch(ScaLP::Exception& e)
+  { // no dual values
+    std::cout << e.what() << std::endl;
+    return 0;
+  }
+
+  ScaLP::Result res = s.getResult();
+  std::cout << "status: " << stat << ", patterns: " << patterns << std::endl;
+  std::cout << res << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+  if(patterns==0) return 2;
+
+  // the lower bound is the total width, the start patterns need 8 rolls
+  if(res.objectiveValue<(9*3+6*4+4*5)/10.0-1e-6) return 3;
+  if(res.objectiveValue>8-1e-6) return 4;
+
+  // no pattern has a negative reduced cost now
+  if(not pricing(res).empty()) return 5;
+
+  // the reduced costs of the used patterns vanish
+  for(auto& p:res.values)
+  {
+    if(p.second>1e-6 and std::abs(res.reducedCosts[p.first])>1e-6) return 6;
+  }
+
+  return 0;
+}
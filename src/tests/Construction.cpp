@@ -0,0 +1,70 @@
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <ScaLP/Solver.h>
+
+// construction time of a model with many (range) rows:
+// min sum x_i, 1 <= x_i + x_{i+1} <= 3, 0 <= x_i <= 10
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  // the number of rows (optional second argument)
+  const int n = (argc>2) ? std::atoi(argv[2]) : 100000;
+  if(n<2 or n%2!=0) return -2;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+  s.setConstraintCount(n);
+
+  std::vector<ScaLP::Variable> x;
+  x.reserve(n+1);
+  ScaLP::Term sum;
+  for(int i=0;i<=n;++i)
+  {
+    x.push_back(ScaLP::newRealVariable("x"+std::to_string(i),0,10));
+    sum += x.back();
+  }
+  for(int i=0;i<n;++i)
+  {
+    s << (1 <= x[i] + x[i+1] <= 3);
+  }
+  s.setObjective(ScaLP::minimize(sum));
+
+  ScaLP::status stat = s.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+
+  const ScaLP::Result& res = s.getResult();
+  const ScaLP::Timings& t = res.timings;
+  std::cout << "rows: " << n << std::endl;
+  std::cout << "construction: " << t.construction.wall << " s ("
+            << n/std::max(t.construction.wall,1e-9) << " rows/s)" << std::endl;
+  std::cout << "solving: " << t.solving.wall << " s" << std::endl;
+
+  // a minimal vertex cover of the path
+  if(std::abs(res.objectiveValue-n/2)>1e-6*n) return 2;
+
+  // the ranges: a row at its upper side
+  s << (x[0] >= 3);
+  stat = s.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 3;
+  if(std::abs(s.getResult().values.at(x[1]))>1e-6) return 4;
+
+  // an empty range is infeasible
+  ScaLP::Solver e{argv[1]};
+  e.quiet=true;
+  e << (5 <= x[0] + x[1] <= 3);
+  e.setObjective(ScaLP::minimize(x[0]));
+  stat = e.solve();
+  std::cout << "empty range: " << stat << std::endl;
+  if(stat!=ScaLP::status::INFEASIBLE) return 5;
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+
+#include <iostream>
+#include <cmath>
+#include <chrono>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,5);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,5);
+  s << (2*x + 2*y <= 7);
+  s << (x - y <= 0.5);
+  s.setObjective(ScaLP::maximize(x+2*y));
+
+  // enough time: the usual result
+  s.setDeadline(60.5);
+  ScaLP::status stat = s.solve();
+  std::cout << "deadline in the future: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+  if(std::abs(s.getResult().objectiveValue-6)>1e-6) return 2;
+
+  // the deadline passed: the backend does not run
+  s << (x + y >= 0);
+  s.deadline = std::chrono::steady_clock::now();
+  stat = s.solve();
+  std::cout << "deadline passed: " << stat << std::endl;
+  if(stat!=ScaLP::status::TIMEOUT_INFEASIBLE) return 3;
+  if(not s.getResult().values.empty()) return 4;
+
+  // the solve is repeated, with a feasible warm-start as result
+  ScaLP::Result start;
+  start.values = {{x,1},{y,2}};
+  s.warmStart=true;
+  stat = s.solve(start);
+  std::cout << "deadline passed, warm-start: " << stat << std::endl;
+  if(stat!=ScaLP::status::TIMEOUT_FEASIBLE) return 5;
+  ScaLP::Result res = s.getResult();
+  std::cout << res << std::endl;
+  if(std::abs(res.objectiveValue-5)>1e-6 or res.values.size()!=2) return 6;
+
+  // an infeasible warm-start is not used
+  start.values = {{x,3},{y,3}};
+  stat = s.solve(start);
+  if(stat!=ScaLP::status::TIMEOUT_INFEASIBLE) return 7;
+
+  // without deadline, the limit of the backend is removed again
+  s.deadline = std::chrono::steady_clock::time_point::max();
+  s.warmStart=false;
+  stat = s.solve();
+  std::cout << "no deadline: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 8;
+  if(std::abs(s.getResult().objectiveValue-6)>1e-6) return 9;
+
+  return 0;
+}
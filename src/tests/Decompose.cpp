@@ -0,0 +1,59 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+// independent knapsacks, one per site
+static std::vector<ScaLP::Variable> build(ScaLP::Solver& s, int sites)
+{
+  std::vector<ScaLP::Variable> xs;
+  ScaLP::Term value;
+  for(int site=0;site<sites;++site)
+  {
+    ScaLP::Term weight;
+    for(int i=0;i<8;++i)
+    {
+      ScaLP::Variable x = ScaLP::newBinaryVariable("x_"+std::to_string(site)+"_"+std::to_string(i));
+      weight += (3+(i*7+site)%11)*x;
+      value  += (2+(i*5+site*3)%13)*x;
+      xs.push_back(x);
+    }
+    s << (weight <= 20+site);
+  }
+  s.setObjective(ScaLP::maximize(value));
+  return xs;
+}
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  const int sites=6;
+
+  ScaLP::Solver whole{argv[1]};
+  std::cout << whole.getBackendName() << std::endl;
+  build(whole,sites);
+  if(whole.solve()!=ScaLP::status::OPTIMAL) return 1;
+
+  ScaLP::Solver s{argv[1]};
+  s.decompose=true;
+  std::vector<ScaLP::Variable> xs = build(s,sites);
+  ScaLP::status stat = s.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 2;
+
+  ScaLP::Result res = s.getResult();
+  std::cout << res << std::endl;
+  if(std::abs(res.objectiveValue-whole.getResult().objectiveValue)>1e-6) return 3;
+  if(res.values.size()!=xs.size()) return 4;
+  if(not s.isFeasible(res)) return 5;
+
+  // an infeasible site makes the whole model infeasible
+  s << (xs[0]+xs[1] >= 3);
+  stat = s.solve();
+  if(stat!=ScaLP::status::INFEASIBLE and stat!=ScaLP::status::INFEASIBLE_OR_UNBOUND) return 6;
+
+  return 0;
+}
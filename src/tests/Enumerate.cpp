@@ -0,0 +1,78 @@
+
+#include <iostream>
+#include <cmath>
+#include <set>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+
+  // a small knapsack with several optimal solutions
+  const int n=6;
+  const int weight[n] = {3,4,2,3,5,4};
+  const int value[n]  = {4,5,3,4,6,5};
+  const int capacity  = 9;
+  std::vector<ScaLP::Variable> x;
+  ScaLP::Term w;
+  ScaLP::Term v;
+  for(int i=0;i<n;++i)
+  {
+    x.push_back(ScaLP::newBinaryVariable("x"+std::to_string(i)));
+    w += weight[i]*x[i];
+    v += value[i]*x[i];
+  }
+  s << (w <= capacity);
+  s.setObjective(ScaLP::maximize(v));
+
+  // the objective values of all packings (best first)
+  std::multiset<int,std::greater<int>> packings;
+  for(int m=0;m<(1<<n);++m)
+  {
+    int tw=0, tv=0;
+    for(int i=0;i<n;++i)
+    {
+      if(m&(1<<i))
+      {
+        tw+=weight[i];
+        tv+=value[i];
+      }
+    }
+    if(tw<=capacity) packings.insert(tv);
+  }
+  const int optimum = *packings.begin();
+
+  // all optimal solutions
+  ScaLP::SolutionPool all = s.enumerate(0);
+  std::cout << all;
+  if(all.status!=ScaLP::status::OPTIMAL) return 1;
+  if(all.size()!=packings.count(optimum)) return 2;
+
+  // the 8 best solutions
+  ScaLP::SolutionPool best = s.enumerate(8,1);
+  std::cout << best;
+  if(best.status!=ScaLP::status::OPTIMAL or best.size()!=8) return 3;
+  auto it = packings.begin();
+  std::set<std::vector<double>> distinct;
+  for(std::size_t k=0;k<best.size();++k,++it)
+  {
+    if(std::abs(best.objectiveValues[k]-*it)>1e-6) return 4;
+    std::vector<double> row;
+    for(std::size_t j=0;j<best.variables.size();++j) row.push_back(best.value(k,j));
+    distinct.insert(row);
+    if(not s.isFeasible(best.result(k))) return 5;
+  }
+  if(distinct.size()!=best.size()) return 6;
+
+  // the model is unchanged
+  if(s.getConstraintCount()!=1) return 7;
+  if(std::abs(s.getResult().objectiveValue-optimum)>1e-6) return 8;
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <ScaLP/Solver.h>
+
+// re-solves pass only the changes to backends with incremental support:
+// min sum x_i, x_i + x_{i+1} >= 1, 0 <= x_i <= 10
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  // the number of rows (optional second argument)
+  const int n = (argc>2) ? std::atoi(argv[2]) : 2000;
+  if(n<2 or n%2!=0) return -2;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+  const bool incremental = s.featureSupported(ScaLP::Feature::INCREMENTAL);
+
+  std::vector<ScaLP::Variable> x;
+  ScaLP::Term sum;
+  for(int i=0;i<=n;++i)
+  {
+    x.push_back(ScaLP::newRealVariable("x"+std::to_string(i),0,10));
+    sum += x.back();
+  }
+  for(int i=0;i<n;++i)
+  {
+    s << (x[i] + x[i+1] >= 1);
+  }
+  s.setObjective(ScaLP::minimize(sum));
+
+  // the objective and the saved construction time of a re-solve
+  auto check = [&](double expected, bool saved, const std::string& step)
+  {
+    ScaLP::status stat = s.solve();
+    const ScaLP::Result& res = s.getResult();
+    std::cout << step << ": " << stat << ", " << res.objectiveValue
+              << ", saved " << res.savedConstructionTime << " s" << std::endl;
+    if(stat!=ScaLP::status::OPTIMAL) return false;
+    if(std::abs(res.objectiveValue-expected)>1e-6*n) return false;
+    return saved ? res.savedConstructionTime>0 : res.savedConstructionTime==0;
+  };
+
+  // the first solve builds the model
+  if(not check(n/2,false,"built")) return 1;
+
+  // an added row is passed without a rebuild
+  s << (x[0] >= 3);
+  if(not check(3+n/2,incremental,"added row")) return 2;
+
+  // the rows of a scope are removed from the backend
+  s.push();
+  s << (x[n] >= 5);
+  if(not check(7+n/2,incremental,"pushed row")) return 3;
+  s.pop();
+  if(not check(3+n/2,incremental,"removed row")) return 4;
+
+  // a changed bound
+  s.setBounds(x[1],1,10);
+  if(not check(3+n/2,incremental,"changed bound")) return 5;
+
+  // the model is rebuilt after a reset
+  if(incremental)
+  {
+    s.reset();
+    s << (x[0] + x[1] >= 1);
+    s.setObjective(ScaLP::minimize(x[0]+x[1]));
+    if(not check(1,false,"rebuilt")) return 6;
+  }
+
+  return 0;
+}
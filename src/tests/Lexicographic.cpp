@@ -0,0 +1,60 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+
+  // two jobs: cost, then tardiness, then overtime
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,5);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,5);
+  ScaLP::Variable z = ScaLP::newRealVariable("z",0,4);
+  s << (x + y >= 4);
+  s << (x + z <= 6);
+
+  // the second stage may lose 25% of its optimum
+  s.setObjectives({ScaLP::minimize(x+y+1), ScaLP::maximize(x), ScaLP::minimize(z-y)},{0,0.25});
+
+  ScaLP::status stat = s.solve();
+  std::cout << "status: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+
+  ScaLP::Result res = s.getResult();
+  std::cout << res << std::endl;
+  const double expected[3] = {5,4,-1};
+  if(res.stages.size()!=3) return 2;
+  for(std::size_t i=0;i<3;++i)
+  {
+    std::cout << "stage " << i << ": " << res.stages[i].objectiveValue << " in " << res.stages[i].timings.total.wall << "s" << std::endl;
+    if(res.stages[i].status!=ScaLP::status::OPTIMAL) return 3;
+    if(std::abs(res.stages[i].objectiveValue-expected[i])>1e-6) return 4;
+    if(res.stages[i].timings.total.wall>res.timings.total.wall) return 4;
+  }
+  if(std::abs(res.objectiveValue+1)>1e-6) return 5;
+  if(std::abs(res.values[x]-3)>1e-6 or std::abs(res.values[y]-1)>1e-6) return 6;
+
+  // the fixing constraints are removed again
+  if(s.getConstraintCount()!=2) return 7;
+
+  // a single objective replaces the stages
+  s.setObjective(ScaLP::maximize(x));
+  if(s.solve()!=ScaLP::status::OPTIMAL) return 8;
+  if(not s.getResult().stages.empty() or std::abs(s.getResult().objectiveValue-5)>1e-6) return 9;
+
+  // a reset removes the stages
+  s.setObjectives({ScaLP::minimize(x+y), ScaLP::maximize(x)},{0});
+  s.reset();
+  s << (x + y >= 4);
+  if(s.solve()!=ScaLP::status::OPTIMAL) return 10;
+  if(not s.getResult().stages.empty()) return 11;
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+
+#include <ScaLP/Exception.h>
+#include <ScaLP/ModelBuilder.h>
+#include <ScaLP/Solver.h>
+
+#include <thread>
+#include <vector>
+
+// build a small transport-like model with one shard per period
+static void fill(ScaLP::ModelBuilder& b, const std::vector<ScaLP::Variable>& x, int p)
+{
+  const int n = x.size();
+  for(int i=0;i<n;++i)
+  {
+    b << (x[i] + (p+1)*x[(i+p)%n] <= 10*(p+1));
+  }
+  b.addObjectiveTerm((p+1)*x[p%n]);
+}
+
+int main(int argc, char** argv)
+{
+  const int periods = 8;
+  std::vector<ScaLP::Variable> x;
+  for(int i=0;i<20;++i) x.push_back(ScaLP::newRealVariable("x"+std::to_string(i),0,10));
+
+  // sequential reference
+  ScaLP::Solver ref(nullptr);
+  ScaLP::Term obj = x[0];
+  for(int p=0;p<periods;++p)
+  {
+    ScaLP::ModelBuilder b;
+    fill(b,x,p);
+    for(auto& c:b.getConstraints()) ref << ScaLP::Constraint(c);
+    obj+=b.getObjectiveTerm();
+  }
+  ref.setObjective(ScaLP::maximize(obj));
+
+  // concurrent construction
+  ScaLP::Solver s(nullptr);
+  s.setObjective(ScaLP::maximize(x[0]));
+  std::vector<ScaLP::ModelBuilder> shards(periods);
+  std::vector<std::thread> ts;
+  for(int p=0;p<periods;++p)
+  {
+    ts.emplace_back([&shards,&x,p]{ fill(shards[p],x,p); });
+  }
+  for(auto& t:ts) t.join();
+  s.merge(std::move(shards));
+
+  if(s.showLP()!=ref.showLP()) return 1;
+
+  // a name-collision must be detected and the model must stay untouched
+  ScaLP::ModelBuilder bad;
+  bad << (ScaLP::newRealVariable("x3") <= 1);
+  try
+  {
+    s.merge(std::move(bad));
+    return 2;
+  }
+  catch(ScaLP::Exception& e)
+  {
+  }
+  if(s.showLP()!=ref.showLP()) return 3;
+
+  return 0;
+}
@@ -0,0 +1,40 @@
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,20);
+  ScaLP::Variable y = ScaLP::newRealVariable("y",-5,ScaLP::INF());
+  ScaLP::Variable b = ScaLP::newBinaryVariable("b");
+  ScaLP::Variable z = ScaLP::newRealVariable("z",0,1e6);
+
+  ScaLP::Solver s(nullptr);
+  s.setObjective(ScaLP::maximize(x+y));
+  s << (x + 2*y <= 10);
+  s << (3*x - 0.5*y + b == 4);
+  s << (1 <= x + y + b <= 100);
+
+  auto st = s.statistics();
+  if(st.variables!=3 or st.binaryVariables!=1 or st.integerVariables!=1 or st.realVariables!=1) return 1;
+  if(st.constraints!=3 or st.equalities!=1 or st.ranges!=1) return 2;
+  if(st.nonzeros!=8) return 3;
+  if(st.minCoefficient!=0.5 or st.maxCoefficient!=3 or st.coefficientRange()!=6) return 4;
+  if(st.minRHS!=1 or st.maxRHS!=100) return 5;
+  if(st.minBound!=1 or st.maxBound!=20) return 6;
+  if(st.rowLengths.size()!=2 or st.rowLengths[1]!=3) return 7;
+
+  // removed constraints and variables are not counted anymore
+  s.push();
+  s << (1e-4*z + x <= 1);
+  st = s.statistics();
+  if(st.variables!=4 or st.constraints!=4 or st.minCoefficient!=1e-4 or st.maxBound!=1e6) return 8;
+  s.pop();
+  st = s.statistics();
+  if(st.variables!=3 or st.constraints!=3 or st.minCoefficient!=0.5 or st.maxBound!=20) return 9;
+
+  // the extreme bounds follow changed bounds
+  s.setBounds(x,0,50);
+  if(s.statistics().maxBound!=50) return 10;
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <cmath>
+#include <chrono>
+#include <string>
+
+#include <ScaLP/Solver.h>
+
+// a knapsack which takes some time
+static void knapsack(ScaLP::Solver& s)
+{
+  const int n=60;
+  ScaLP::Term weight;
+  ScaLP::Term value;
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::Variable x = ScaLP::newBinaryVariable("x"+std::to_string(i));
+    weight += (1000+(i*7919)%997)*x;
+    value  += (1000+(i*104729)%991)*x;
+  }
+  s.setObjective(ScaLP::maximize(value));
+  s << (weight <= 20011);
+  s.quiet=true;
+}
+
+// two instances of the same backend race each other
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+  const std::string portfolio = "Portfolio:"+std::string(argv[1])+","+argv[1];
+
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,5);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,5);
+
+  // the result of the winner
+  {
+    ScaLP::Solver s{portfolio};
+    std::cout << s.getBackendName() << std::endl;
+    s.quiet=true;
+    s << (2*x + 2*y <= 7);
+    s << (x - y <= 0.5);
+    s.setObjective(ScaLP::maximize(x+2*y));
+
+    ScaLP::status stat = s.solve();
+    std::cout << "status: " << stat << std::endl;
+    if(stat!=ScaLP::status::OPTIMAL) return 1;
+    if(std::abs(s.getResult().objectiveValue-6)>1e-6) return 2;
+
+    // the next solve is not interrupted by the race of the first one
+    s.setObjective(ScaLP::maximize(2*x+y));
+    if(s.solve()!=ScaLP::status::OPTIMAL) return 3;
+    if(std::abs(s.getResult().objectiveValue-4)>1e-6) return 4;
+  }
+
+  // an infeasible model
+  {
+    ScaLP::Solver s{portfolio};
+    s.quiet=true;
+    s << (x + y >= 11);
+    s.setObjective(ScaLP::minimize(x));
+    ScaLP::status stat = s.solve();
+    std::cout << "infeasible: " << stat << std::endl;
+    if(stat!=ScaLP::status::INFEASIBLE and stat!=ScaLP::status::INFEASIBLE_OR_UNBOUND) return 5;
+  }
+
+  // the progress callback stops every member
+  {
+    ScaLP::Solver s{portfolio};
+    knapsack(s);
+    bool stopped=false;
+    s.setProgressCallback([&stopped](const ScaLP::Progress& p)
+    {
+      if(p.incumbent!=nullptr) stopped=true;
+      return p.incumbent==nullptr;
+    });
+
+    ScaLP::status stat = s.solve();
+    std::cout << "stopped: " << stat << std::endl;
+    if(stopped and stat!=ScaLP::status::CANCELLED_FEASIBLE and stat!=ScaLP::status::OPTIMAL) return 6;
+    if(not stopped and stat!=ScaLP::status::OPTIMAL) return 7;
+    if(stat==ScaLP::status::CANCELLED_FEASIBLE and s.getResult().values.empty()) return 8;
+
+    // without callback the solve runs to the end
+    s.setProgressCallback(nullptr);
+    if(stat!=ScaLP::status::OPTIMAL and s.solve()!=ScaLP::status::OPTIMAL) return 9;
+  }
+
+  // a cancel interrupts every member
+  {
+    ScaLP::Solver s{portfolio};
+    knapsack(s);
+    ScaLP::SolveHandle h = s.solveAsync();
+    h.cancel();
+    h.wait_for(std::chrono::seconds(600));
+    if(not h.ready()) return 10;
+
+    ScaLP::status stat = h.get();
+    std::cout << "cancelled: " << stat << std::endl;
+    if(stat!=ScaLP::status::CANCELLED_FEASIBLE
+      and stat!=ScaLP::status::CANCELLED_INFEASIBLE
+      and stat!=ScaLP::status::OPTIMAL)
+    {
+      return 11;
+    }
+    if(stat!=ScaLP::status::OPTIMAL and s.solve()!=ScaLP::status::OPTIMAL) return 12;
+  }
+
+  return 0;
+}
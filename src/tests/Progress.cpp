@@ -0,0 +1,56 @@
+
+#include <iostream>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+
+  if(s.getBackendName()=="Dynamic: LPSolve") s.presolve=false;
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  // a knapsack which takes some time
+  const int n=60;
+  ScaLP::Term weight;
+  ScaLP::Term value;
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::Variable x = ScaLP::newBinaryVariable("x"+std::to_string(i));
+    weight += (1000+(i*7919)%997)*x;
+    value  += (1000+(i*104729)%991)*x;
+  }
+  s.setObjective(ScaLP::maximize(value));
+  s << (weight <= 20011);
+
+  // stop at the first incumbent
+  int incumbents=0;
+  s.setProgressCallback([&incumbents](const ScaLP::Progress& p)
+  {
+    if(p.incumbent!=nullptr) ++incumbents;
+    return p.incumbent==nullptr;
+  });
+
+  ScaLP::status stat = s.solve();
+  std::cout << "stopped: " << stat << std::endl;
+  if(stat==ScaLP::status::CANCELLED_FEASIBLE)
+  {
+    if(incumbents!=1) return 1;
+    if(s.getResult().values.empty()) return 2;
+  }
+  else if(stat!=ScaLP::status::OPTIMAL)
+  {
+    return 3;
+  }
+
+  // without callback the solve runs to the end
+  s.setProgressCallback(nullptr);
+  if(stat!=ScaLP::status::OPTIMAL and s.solve()!=ScaLP::status::OPTIMAL) return 4;
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,5);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,5);
+  s << (2*x + 2*y <= 7);
+  s << (x - y <= 0.5);
+  s.setObjective(ScaLP::maximize(x+2*y));
+
+  // the LP relaxation: y=3.5
+  ScaLP::status stat = s.solveRelaxation();
+  std::cout << "relaxation: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+  ScaLP::Result relaxed = s.getResult();
+  std::cout << relaxed << std::endl;
+  if(std::abs(relaxed.objectiveValue-7)>1e-6) return 2;
+  if(std::abs(relaxed.values[y]-3.5)>1e-6) return 3;
+  if(std::abs(s.getRelaxationBound()-7)>1e-6) return 4;
+
+  // the variables are still integer
+  if(x->getType()!=ScaLP::VariableType::INTEGER or y->getType()!=ScaLP::VariableType::INTEGER) return 5;
+
+  // the integer problem uses the bound as reference
+  stat = s.solve();
+  std::cout << "integer: " << stat << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 6;
+  const ScaLP::Result res = s.getResult();
+  std::cout << res << std::endl;
+  if(std::abs(res.objectiveValue-6)>1e-6) return 7;
+  if(std::abs(res.statistics.relaxationBound-7)>1e-6) return 8;
+  if(std::abs(res.statistics.relaxationGap-1.0/6)>1e-6) return 9;
+
+  // looser bounds invalidate it
+  s.setBounds(y,0,4);
+  if(not std::isnan(s.getRelaxationBound())) return 10;
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+
+#include <iostream>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+
+  if(s.getBackendName()=="Dynamic: LPSolve") s.presolve=false;
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,10);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,10);
+
+  s.setObjective(ScaLP::maximize(x+2*y));
+  s << (x+y<=8);
+
+  auto check = [&s](double expected, const std::string& step)
+  {
+    ScaLP::status stat = s.solve();
+    if(stat!=ScaLP::status::OPTIMAL or s.getResult().objectiveValue!=expected)
+    {
+      std::cout << step << " not passed (" << stat << ", " << s.getResult().objectiveValue << ")" << std::endl;
+      return false;
+    }
+    std::cout << step << " passed." << std::endl;
+    return true;
+  };
+
+  if(not check(16,"base model")) return -1;
+
+  // dive: fix a bound
+  s.push();
+  s.setBounds(y,0,3);
+  if(not check(11,"bound change")) return -1;
+
+  // dive: add a constraint
+  s.push();
+  s << (x<=2);
+  if(not check(8,"added constraint")) return -1;
+
+  // undo the constraint
+  s.pop();
+  if(not check(11,"first pop")) return -1;
+
+  // undo the bound change
+  s.pop();
+  if(not check(16,"second pop")) return -1;
+
+  if(y->getUpperBound()!=10)
+  {
+    std::cout << "bounds not restored" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
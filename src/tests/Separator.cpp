@@ -0,0 +1,48 @@
+
+#include <iostream>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,10);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,10);
+  s.setObjective(ScaLP::maximize(2*x+y));
+  s << (x+y <= 15);
+
+  // the constraints are only known to the separator,
+  // only the first violated one is returned.
+  std::vector<ScaLP::Constraint> lazy{x+y<=7, x-y<=2, x<=8};
+  int calls=0;
+  ScaLP::status stat = s.solveWithSeparator([&](const ScaLP::Result& r)
+  {
+    ++calls;
+    for(ScaLP::Constraint& c:lazy)
+    {
+      if(not c.isFeasible(r)) return std::vector<ScaLP::Constraint>{c};
+    }
+    return std::vector<ScaLP::Constraint>{};
+  });
+
+  std::cout << "status: " << stat << ", separator calls: " << calls << std::endl;
+  if(stat!=ScaLP::status::OPTIMAL) return 1;
+  if(calls==0) return 2;
+
+  ScaLP::Result res = s.getResult();
+  std::cout << res << std::endl;
+  if(res.values[x]!=4 or res.values[y]!=3) return 3;
+
+  // the generated constraints are part of the model now
+  if(s.getConstraintCount()<2) return 4;
+  if(s.solve()!=ScaLP::status::ALREADY_SOLVED) return 5;
+
+  return 0;
+}
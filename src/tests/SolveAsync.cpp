@@ -0,0 +1,57 @@
+
+#include <iostream>
+#include <chrono>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+
+  if(s.getBackendName()=="Dynamic: LPSolve") s.presolve=false;
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  // a knapsack which takes some time
+  const int n=60;
+  ScaLP::Term weight;
+  ScaLP::Term value;
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::Variable x = ScaLP::newBinaryVariable("x"+std::to_string(i));
+    weight += (1000+(i*7919)%997)*x;
+    value  += (1000+(i*104729)%991)*x;
+  }
+  s.setObjective(ScaLP::maximize(value));
+  s << (weight <= 20011);
+
+  // cancel right away, the solve may be finished already
+  ScaLP::SolveHandle h = s.solveAsync();
+  h.cancel();
+  h.wait_for(std::chrono::seconds(600));
+  if(not h.ready()) return 1;
+
+  ScaLP::status stat = h.get();
+  std::cout << "cancelled: " << stat << std::endl;
+  if(stat!=ScaLP::status::CANCELLED_FEASIBLE
+    and stat!=ScaLP::status::CANCELLED_INFEASIBLE
+    and stat!=ScaLP::status::OPTIMAL)
+  {
+    return 2;
+  }
+  if(stat==ScaLP::status::CANCELLED_FEASIBLE and s.getResult().values.empty()) return 3;
+
+  // a cancelled solve is repeated by the next solve and not cancelled again
+  if(stat!=ScaLP::status::OPTIMAL)
+  {
+    ScaLP::SolveHandle h2 = s.solveAsync();
+    if(h2.get()!=ScaLP::status::OPTIMAL) return 4;
+    if(h2.cancel()) return 5; // already finished
+  }
+
+  return 0;
+}
@@ -0,0 +1,42 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+
+  // print the name of the detected Solver in the log
+  std::cout << s.getBackendName() << std::endl;
+
+  // a small knapsack
+  const int n=20;
+  ScaLP::Term weight;
+  ScaLP::Term value;
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::Variable x = ScaLP::newBinaryVariable("x"+std::to_string(i));
+    weight += (10+(i*7)%13)*x;
+    value  += (10+(i*11)%17)*x;
+  }
+  s.setObjective(ScaLP::maximize(value));
+  s << (weight <= 100);
+
+  if(s.solve()!=ScaLP::status::OPTIMAL) return 1;
+
+  const ScaLP::Result r = s.getResult();
+  const ScaLP::SolveStatistics& st = r.statistics;
+  std::cout << st;
+
+  // every backend reports the bound of an optimal solve
+  if(std::isnan(st.dualBound) or std::abs(st.dualBound-r.objectiveValue)>1e-4*std::max(1.0,std::abs(r.objectiveValue))) return 2;
+  if(st.iterations<0) return 3;
+  if(st.solutions==0) return 4;
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include <ScaLP/Solver.h>
+#include <ScaLP/SolverPool.h>
+
+// max x+y, x+2y<=i, 0<=x,y<=i (integer)
+static ScaLP::Objective model(int i, ScaLP::ModelBuilder& b)
+{
+  ScaLP::Variable x = ScaLP::newIntegerVariable("x",0,i);
+  ScaLP::Variable y = ScaLP::newIntegerVariable("y",0,i);
+  b << (x + 2*y <= i);
+  return ScaLP::maximize(x+y);
+}
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::SolverPool pool({argv[1]},4);
+
+  // print the name of the detected Solver in the log
+  std::cout << pool.getBackendName() << std::endl;
+
+  const int n=200;
+  std::vector<std::future<ScaLP::SolverPool::Outcome>> fs;
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::ModelBuilder b;
+    ScaLP::Objective o = model(i,b);
+    fs.push_back(pool.submit(o,std::move(b)));
+  }
+
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::SolverPool::Outcome r = fs[i].get();
+    if(r.first!=ScaLP::status::OPTIMAL) return 1;
+    if(r.second.objectiveValue<i-0.5 or r.second.objectiveValue>i+0.5) return 2;
+  }
+
+  // callbacks
+  std::atomic<int> solved{0};
+  for(int i=0;i<n;++i)
+  {
+    ScaLP::ModelBuilder b;
+    ScaLP::Objective o = model(i,b);
+    pool.submit(o,std::move(b),[&solved](ScaLP::status s, const ScaLP::Result&)
+    {
+      if(s==ScaLP::status::OPTIMAL) ++solved;
+    });
+  }
+  pool.wait();
+  if(solved!=n) return 3;
+
+  // batches of stacked models, compared to one solve per model
+  for(std::size_t batch:{std::size_t(1),std::size_t(25)})
+  {
+    pool.batchSize=batch;
+    auto start = std::chrono::steady_clock::now();
+    fs.clear();
+    for(int i=0;i<n;++i)
+    {
+      ScaLP::ModelBuilder b;
+      ScaLP::Objective o = model(i,b);
+      if(i==7) b << (ScaLP::newIntegerVariable("z",0,1) >= 2); // infeasible
+      fs.push_back(pool.submit(o,std::move(b)));
+    }
+    for(int i=0;i<n;++i)
+    {
+      ScaLP::SolverPool::Outcome r = fs[i].get();
+      if(i==7)
+      {
+        if(r.first==ScaLP::status::OPTIMAL) return 4;
+        continue;
+      }
+      if(r.first!=ScaLP::status::OPTIMAL) return 5;
+      if(r.second.objectiveValue<i-0.5 or r.second.objectiveValue>i+0.5) return 6;
+      if(r.second.values.size()!=2) return 7;
+    }
+    std::chrono::duration<double> d = std::chrono::steady_clock::now()-start;
+    std::cout << "batch size " << batch << ": " << n/d.count() << " models per second" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+static ScaLP::Variable x = ScaLP::newRealVariable("x",0,10);
+static ScaLP::Variable y = ScaLP::newRealVariable("y",0,10);
+static ScaLP::Variable z = ScaLP::newRealVariable("z",0,10);
+
+static void build(ScaLP::Solver& s, double rhs, double cy, double lower=-2, double fixed=2)
+{
+  s << (x + y <= rhs);
+  s << (x - y >= lower);
+  s << (1 <= x + 2*y <= 9);
+  s << (z == fixed);
+  s.setObjective(ScaLP::maximize(3*x+cy*y+z));
+}
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  ScaLP::Solver s{argv[1]};
+  std::cout << s.getBackendName() << std::endl;
+  s.quiet=true;
+  build(s,4,2);
+  if(s.solve()!=ScaLP::status::OPTIMAL) return 1;
+  const double base = s.getResult().objectiveValue;
+
+  // change the right-hand side of the first constraint and every second
+  // time the coefficient of y
+  std::vector<ScaLP::SweepPoint> ps;
+  for(int k=0;k<6;++k)
+  {
+    ScaLP::SweepPoint p;
+    p.bounds.push_back({0,4.0+k});
+    if(k%2==1) p.objective[y]=5;
+    ps.push_back(p);
+  }
+
+  for(unsigned int workers:{1u,2u})
+  {
+    auto rs = s.sweep(ps,workers);
+    if(rs.size()!=ps.size()) return 2;
+    for(std::size_t k=0;k<ps.size();++k)
+    {
+      // compare with a new model of the point
+      ScaLP::Solver t{argv[1]};
+      t.quiet=true;
+      build(t,4.0+k,(k%2==1)?5:2);
+      if(t.solve()!=ScaLP::status::OPTIMAL) return 3;
+      std::cout << workers << " " << k << ": " << rs[k].second.objectiveValue << std::endl;
+      if(rs[k].first!=ScaLP::status::OPTIMAL) return 4;
+      if(std::abs(rs[k].second.objectiveValue-t.getResult().objectiveValue)>1e-6) return 5;
+    }
+  }
+
+  // nonzero bounds of ">=" and "==" constraints
+  std::vector<ScaLP::SweepPoint> qs;
+  const double lowers[3] = {-1,0.5,1};
+  const double fixeds[3] = {1,3,4};
+  for(int k=0;k<3;++k)
+  {
+    ScaLP::SweepPoint q;
+    q.bounds.push_back({1,lowers[k]});
+    q.bounds.push_back({3,fixeds[k]});
+    qs.push_back(q);
+  }
+  auto rs = s.sweep(qs);
+  if(rs.size()!=qs.size()) return 9;
+  for(std::size_t k=0;k<qs.size();++k)
+  {
+    ScaLP::Solver t{argv[1]};
+    t.quiet=true;
+    build(t,4,2,lowers[k],fixeds[k]);
+    if(t.solve()!=ScaLP::status::OPTIMAL) return 10;
+    std::cout << "bounds " << k << ": " << rs[k].second.objectiveValue << std::endl;
+    if(rs[k].first!=ScaLP::status::OPTIMAL) return 11;
+    if(std::abs(rs[k].second.objectiveValue-t.getResult().objectiveValue)>1e-6) return 12;
+    if(std::abs(rs[k].second.values.at(z)-fixeds[k])>1e-6) return 13;
+  }
+
+  // the model is unchanged
+  if(s.getConstraints()[0].ubound!=4) return 6;
+  s.solve();
+  if(std::abs(s.getResult().objectiveValue-base)>1e-6) return 7;
+
+  // ranges need both bounds
+  try
+  {
+    s.setConstraintBound(2,3);
+    return 8;
+  }
+  catch(ScaLP::Exception&)
+  {
+  }
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+
+#include <ScaLP/ThreadScheduler.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+int main()
+{
+  ScaLP::ThreadScheduler s(8);
+
+  // a single solve gets half of the budget, a limited one its request
+  {
+    ScaLP::ThreadScheduler::Allocation a = s.acquire();
+    if(a.threads()!=4) return 1;
+  }
+  {
+    ScaLP::ThreadScheduler::Allocation a = s.acquire(3);
+    ScaLP::ThreadScheduler::Allocation b = s.acquire(2);
+    if(a.threads()!=3 or b.threads()!=2) return 2;
+    if(s.metrics().used!=5 or s.metrics().running!=2) return 3;
+  }
+  if(s.metrics().used!=0) return 4;
+
+  s.setLimitPerSolve(s.getBudget());
+  {
+    ScaLP::ThreadScheduler::Allocation a = s.acquire();
+    if(a.threads()!=8) return 5;
+  }
+
+  // a fair share: the budget divided by the running and waiting solves
+  {
+    ScaLP::ThreadScheduler::Allocation a = s.acquire(2);
+    ScaLP::ThreadScheduler::Allocation b = s.acquire();
+    if(b.threads()!=4) return 10;
+  }
+
+  // the released threads are shared by the waiting solves
+  std::vector<std::thread> ts;
+  std::atomic<bool> shared{true};
+  {
+    ScaLP::ThreadScheduler::Allocation all = s.acquire();
+    for(int i=0;i<2;++i)
+    {
+      ts.emplace_back([&s,&shared]()
+      {
+        ScaLP::ThreadScheduler::Allocation a = s.acquire();
+        if(a.threads()<4) shared=false;
+      });
+    }
+    while(s.metrics().waiting<2) std::this_thread::yield();
+  }
+  for(auto& t:ts) t.join();
+  ts.clear();
+  if(not shared) return 9;
+
+  // waiting solves are served by priority
+  ScaLP::ThreadScheduler single(1);
+  std::vector<int> order;
+  std::mutex mutex;
+  {
+    ScaLP::ThreadScheduler::Allocation all = single.acquire();
+    for(int p=0;p<3;++p)
+    {
+      ts.emplace_back([&single,&order,&mutex,p]()
+      {
+        ScaLP::ThreadScheduler::Allocation a = single.acquire(0,p);
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(p);
+      });
+    }
+    while(single.metrics().waiting<3) std::this_thread::yield();
+  }
+  for(auto& t:ts) t.join();
+  if(order!=std::vector<int>({2,1,0})) return 6;
+
+  // the wait ends at the deadline without threads
+  {
+    ScaLP::ThreadScheduler::Allocation all = single.acquire();
+    const auto start = ScaLP::ThreadScheduler::Clock::now();
+    ScaLP::ThreadScheduler::Allocation a = single.acquire(0,0,start+std::chrono::milliseconds(50));
+    if(a.threads()!=0) return 11;
+    if(ScaLP::ThreadScheduler::Clock::now()-start<std::chrono::milliseconds(50)) return 12;
+    if(single.metrics().waiting!=0 or single.metrics().running!=1) return 13;
+  }
+  if(single.metrics().used!=0) return 14;
+
+  ScaLP::ThreadScheduler::Metrics m = s.metrics();
+  if(m.granted!=9 or m.waiting!=0 or m.used!=0) return 7;
+  if(m.utilization<=0 or m.utilization>1) return 8;
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+
+#include <iostream>
+#include <cmath>
+
+#include <ScaLP/Solver.h>
+
+int main(int argc, char** argv)
+{
+  // No solver given
+  if(argc<2) return -1;
+
+  // LP: the second solve starts from the first one
+  {
+    ScaLP::Solver s{argv[1]};
+    std::cout << s.getBackendName() << std::endl;
+    s.quiet=true;
+
+    ScaLP::Variable x = ScaLP::newRealVariable("x",0,3);
+    ScaLP::Variable y = ScaLP::newRealVariable("y",0,10);
+    s << (x + y <= 4);
+    s << (x + 3*y <= 6);
+    s.setObjective(ScaLP::maximize(3*x+2*y));
+
+    ScaLP::status stat = s.solve();
+    std::cout << "cold: " << stat << ", iterations " << s.getResult().statistics.iterations << std::endl;
+    if(stat!=ScaLP::status::OPTIMAL) return 1;
+    if(std::abs(s.getResult().objectiveValue-11)>1e-6) return 2;
+
+    // a similar objective with the same optimal vertex
+    s.warmStart=true;
+    s.setObjective(ScaLP::maximize(3*x+2.5*y));
+    stat = s.solve(s.getResult());
+    std::cout << "warm: " << stat << ", iterations " << s.getResult().statistics.iterations << std::endl;
+    if(stat!=ScaLP::status::OPTIMAL) return 3;
+    if(std::abs(s.getResult().objectiveValue-11.5)>1e-6) return 4;
+  }
+
+  // MIP: max 5a+4b+3c, 2a+3b+c<=5, 4a+b+2c<=11, 3a+4b+2c<=8 (a=2, c=1: 13)
+  ScaLP::Variable a = ScaLP::newIntegerVariable("a",0,10);
+  ScaLP::Variable b = ScaLP::newIntegerVariable("b",0,10);
+  ScaLP::Variable c = ScaLP::newIntegerVariable("c",0,10);
+  ScaLP::Result optimal;
+  optimal.values = {{a,2},{b,0},{c,1}};
+  ScaLP::Result feasible;
+  feasible.values = {{a,1},{b,1},{c,0}};
+  ScaLP::Result infeasible;
+  infeasible.values = {{a,3},{b,3},{c,3}};
+
+  for(const ScaLP::Result* start : {&optimal,&feasible,&infeasible})
+  {
+    ScaLP::Solver s{argv[1]};
+    s.quiet=true;
+    s << (2*a + 3*b + c <= 5);
+    s << (4*a + b + 2*c <= 11);
+    s << (3*a + 4*b + 2*c <= 8);
+    s.setObjective(ScaLP::maximize(5*a+4*b+3*c));
+    s.warmStart=true;
+
+    ScaLP::status stat = s.solve(*start);
+    std::cout << "MIP start: " << stat << std::endl;
+    if(stat!=ScaLP::status::OPTIMAL) return 5;
+    const ScaLP::Result& res = s.getResult();
+    std::cout << res << std::endl;
+    if(std::abs(res.objectiveValue-13)>1e-6) return 6;
+    if(std::abs(res.values.at(a)-2)>1e-6 or std::abs(res.values.at(c)-1)>1e-6) return 7;
+  }
+
+  return 0;
+}